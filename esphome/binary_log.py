@@ -0,0 +1,249 @@
+"""Decoder for the binary log records of the logger component.
+
+See esphome/components/logger/binary_log.h for the record format. Tags and format
+strings in the firmware image are only sent as their address, they are read from
+the ELF file of the firmware, which serves as the string table of the build.
+"""
+from __future__ import annotations
+
+import logging
+import re
+import struct
+
+_LOGGER = logging.getLogger(__name__)
+
+BINARY_LOG_MAGIC = 0xEB
+BINARY_LOG_FLAG_INLINE_TAG = 1 << 0
+BINARY_LOG_FLAG_INLINE_FORMAT = 1 << 1
+
+LOG_LEVEL_COLORS = [
+    "",  # NONE
+    "\033[1;31m",  # ERROR
+    "\033[0;33m",  # WARNING
+    "\033[0;32m",  # INFO
+    "\033[0;35m",  # CONFIG
+    "\033[0;36m",  # DEBUG
+    "\033[0;37m",  # VERBOSE
+    "\033[0;38m",  # VERY_VERBOSE
+]
+LOG_LEVEL_LETTERS = ["", "E", "W", "I", "C", "D", "V", "VV"]
+LOG_RESET_COLOR = "\033[0m"
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+FORMAT_SPEC_RE = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?(.?)", re.DOTALL
+)
+SIGNED_CONVERSIONS = "di"
+UNSIGNED_CONVERSIONS = "ouxXcp"
+FLOAT_CONVERSIONS = "fFeEgGaA"
+
+
+def is_binary_log(payload: bytes) -> bool:
+    return len(payload) > 0 and payload[0] == BINARY_LOG_MAGIC
+
+
+class ElfStrings:
+    """The allocated sections of an ELF file, to read strings by their address."""
+
+    def __init__(self, path: str):
+        self.sections: list[tuple[int, bytes]] = []
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} is not an ELF file")
+        is_64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is_64:
+            shoff, shentsize, shnum = (
+                struct.unpack_from(endian + "Q", data, 0x28)[0],
+                *struct.unpack_from(endian + "HH", data, 0x3A),
+            )
+            section_format = endian + "IIQQQQ"
+        else:
+            shoff, shentsize, shnum = (
+                struct.unpack_from(endian + "I", data, 0x20)[0],
+                *struct.unpack_from(endian + "HH", data, 0x2E),
+            )
+            section_format = endian + "IIIIII"
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                section_format, data, shoff + i * shentsize
+            )
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and addr != 0 and size:
+                self.sections.append((addr, data[offset : offset + size]))
+
+    def read_string(self, address: int) -> str | None:
+        for addr, content in self.sections:
+            if addr <= address < addr + len(content):
+                start = address - addr
+                end = content.find(b"\0", start)
+                if end < 0:
+                    end = len(content)
+                return content[start:end].decode(errors="backslashreplace")
+        return None
+
+
+class _Reader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.pos = 0
+
+    def byte(self) -> int:
+        if self.pos >= len(self.data):
+            raise ValueError("Truncated binary log record")
+        self.pos += 1
+        return self.data[self.pos - 1]
+
+    def varint(self) -> int:
+        value = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return value
+
+    def signed_varint(self) -> int:
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def string(self) -> str:
+        end = self.data.find(b"\0", self.pos)
+        if end < 0:
+            raise ValueError("Truncated binary log record")
+        value = self.data[self.pos : end].decode(errors="backslashreplace")
+        self.pos = end + 1
+        return value
+
+    def f64(self) -> float:
+        if self.pos + 8 > len(self.data):
+            raise ValueError("Truncated binary log record")
+        self.pos += 8
+        return struct.unpack_from("<d", self.data, self.pos - 8)[0]
+
+
+def _format_arg(
+    flags: str, width: int | None, precision: int | None, conversion: str, value
+) -> str:
+    if width is not None and width < 0:
+        flags += "-"
+        width = -width
+    spec = "%" + flags
+    if width is not None:
+        spec += str(width)
+    if precision is not None and precision >= 0:
+        spec += f".{precision}"
+
+    if conversion in "diu":
+        return (spec + "d") % value
+    if conversion == "o" and "#" in flags:
+        # C prints a single leading zero instead of 0o
+        spec = ("%-" if "-" in flags else "%") + str(width or "")
+        return (spec + "s") % f"0{value:o}"
+    if conversion in "oxX":
+        return (spec + conversion) % value
+    if conversion == "c":
+        return (spec + "s") % chr(value)
+    if conversion == "p":
+        return (spec + "s") % f"0x{value:x}"
+    if conversion in "aA":
+        # C leaves out the trailing zeros of the mantissa
+        text = re.sub(r"\.?0+p", "p", float.hex(value))
+        return (spec + "s") % (text.upper() if conversion == "A" else text)
+    if conversion in FLOAT_CONVERSIONS:
+        return (spec + conversion) % value
+    return (spec + "s") % value
+
+
+class BinaryLogDecoder:
+    """Formats binary log records to the same text the device prints."""
+
+    def __init__(self, elf_path: str | None = None):
+        self.strings: ElfStrings | None = None
+        if elf_path is not None:
+            try:
+                self.strings = ElfStrings(elf_path)
+            except (OSError, ValueError, struct.error) as err:
+                _LOGGER.warning("Can't read strings from %s: %s", elf_path, err)
+
+    def _string_at(self, address: int) -> str | None:
+        if self.strings is None:
+            return None
+        return self.strings.read_string(address)
+
+    def decode(self, payload: bytes) -> tuple[int, str, int, str]:
+        """Decode a record to (level, tag, line, message)."""
+        reader = _Reader(payload)
+        if reader.byte() != BINARY_LOG_MAGIC:
+            raise ValueError("Not a binary log record")
+        header = reader.byte()
+        level = header & 0x0F
+        flags = header >> 4
+        line = reader.varint()
+        if flags & BINARY_LOG_FLAG_INLINE_TAG:
+            tag = reader.string()
+        else:
+            address = reader.varint()
+            tag = self._string_at(address) or f"<0x{address:x}>"
+        if flags & BINARY_LOG_FLAG_INLINE_FORMAT:
+            format_ = reader.string()
+        else:
+            address = reader.varint()
+            format_ = self._string_at(address)
+            if format_ is None:
+                arguments = payload[reader.pos :].hex()
+                return level, tag, line, f"<format 0x{address:x}> {arguments}"
+        return level, tag, line, self._format(format_, reader)
+
+    def _format(self, format_: str, reader: _Reader) -> str:
+        parts = []
+        pos = 0
+        while True:
+            start = format_.find("%", pos)
+            if start < 0:
+                parts.append(format_[pos:])
+                break
+            parts.append(format_[pos:start])
+            match = FORMAT_SPEC_RE.match(format_, start)
+            flags, width, precision, _, conversion = match.groups()
+            pos = match.end()
+            if conversion == "%":
+                parts.append("%")
+                continue
+            if conversion == "n":
+                continue
+
+            if width == "*":
+                width = reader.signed_varint()
+            elif width is not None:
+                width = int(width)
+            if precision == "*":
+                precision = reader.signed_varint()
+            elif precision is not None:
+                precision = int(precision or "0")
+
+            if conversion in SIGNED_CONVERSIONS:
+                value = reader.signed_varint()
+            elif conversion in UNSIGNED_CONVERSIONS:
+                value = reader.varint()
+            elif conversion in FLOAT_CONVERSIONS:
+                value = reader.f64()
+            elif conversion == "s":
+                value = reader.string()
+            else:
+                # Invalid conversion, nothing after it was encoded
+                parts.append(format_[start:])
+                break
+            parts.append(_format_arg(flags, width, precision, conversion, value))
+        return "".join(parts)
+
+    def format_line(self, payload: bytes) -> str:
+        """Format a record like the logger writes it, with the header and colors."""
+        level, tag, line, message = self.decode(payload)
+        level = min(max(level, 0), 7)
+        color = LOG_LEVEL_COLORS[level]
+        letter = LOG_LEVEL_LETTERS[level]
+        return f"{color}[{letter}][{tag}:{line:03}]: {message}{LOG_RESET_COLOR}"
@@ -5,6 +5,7 @@ import esphome.config_validation as cv
 from esphome import automation
 from esphome.automation import Condition
 from esphome.const import (
+    CONF_BUFFER_SIZE,
     CONF_DATA,
     CONF_DATA_TEMPLATE,
     CONF_ID,
@@ -47,6 +48,7 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 CONF_ENCRYPTION = "encryption"
+CONF_BATCH_DELAY = "batch_delay"
 
 
 def validate_encryption_key(value):
@@ -89,6 +91,20 @@ CONFIG_SCHEMA = cv.Schema(
                 cv.Required(CONF_KEY): validate_encryption_key,
             }
         ),
+        cv.SplitDefault(
+            CONF_BUFFER_SIZE,
+            esp32="1024B",
+            esp8266="512B",
+            rp2040="1024B",
+            bk72xx="512B",
+            rtl87xx="512B",
+            host="1024B",
+        ): cv.All(cv.validate_bytes, cv.int_range(min=128, max=65536)),
+        cv.Optional(CONF_BATCH_DELAY): cv.All(
+            cv.positive_not_null_time_period,
+            cv.positive_time_period_milliseconds,
+            cv.Range(max=cv.TimePeriod(seconds=1)),
+        ),
         cv.Optional(CONF_ON_CLIENT_CONNECTED): automation.validate_automation(
             single=True
         ),
@@ -107,6 +123,11 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    if CONF_BUFFER_SIZE in config:
+        cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    if CONF_BATCH_DELAY in config:
+        cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+        cg.add_define("USE_API_BATCH")
 
     for conf in config.get(CONF_SERVICES, []):
         template_args = []
@@ -2,6 +2,9 @@
 #include <cerrno>
 #include <cinttypes>
 #include <utility>
+#ifdef USE_RUNTIME_STATS
+#include <map>
+#endif
 #include "esphome/components/network/util.h"
 #include "esphome/core/entity_base.h"
 #include "esphome/core/hal.h"
@@ -29,12 +32,14 @@ static const int ESP32_CAMERA_STOP_STREAM = 5000;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
-  this->proto_write_buffer_.reserve(64);
+  const size_t buffer_size = parent->get_buffer_size();
+  this->proto_write_buffer_.reserve(buffer_size);
 
 #if defined(USE_API_PLAINTEXT)
-  this->helper_ = std::unique_ptr<APIFrameHelper>{new APIPlaintextFrameHelper(std::move(sock))};
+  this->helper_ = std::unique_ptr<APIFrameHelper>{new APIPlaintextFrameHelper(std::move(sock), buffer_size)};
 #elif defined(USE_API_NOISE)
-  this->helper_ = std::unique_ptr<APIFrameHelper>{new APINoiseFrameHelper(std::move(sock), parent->get_noise_ctx())};
+  this->helper_ = std::unique_ptr<APIFrameHelper>{
+      new APINoiseFrameHelper(std::move(sock), parent->get_noise_ctx(), buffer_size)};
 #else
 #error "No frame helper defined"
 #endif
@@ -67,6 +72,20 @@ APIConnection::~APIConnection() {
 #endif
 }
 
+#ifdef USE_TICKLESS_IDLE
+bool APIConnection::can_idle() {
+  if (this->remove_ || this->next_close_ || !this->helper_->can_write_without_blocking())
+    return false;
+  if (this->list_entities_iterator_.is_running() || this->initial_state_iterator_.is_running())
+    return false;
+#ifdef USE_ESP32_CAMERA
+  if (this->image_reader_.available())
+    return false;
+#endif
+  return true;
+}
+#endif
+
 void APIConnection::loop() {
   if (this->remove_)
     return;
@@ -110,7 +129,7 @@ void APIConnection::loop() {
   } else {
     this->last_traffic_ = millis();
     // read a packet
-    this->read_message(buffer.data_len, buffer.type, &buffer.container[buffer.data_offset]);
+    this->read_message(buffer.data_len, buffer.type, buffer.data);
     if (this->remove_)
       return;
   }
@@ -135,7 +154,8 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    // fixed32 key, bytes data and bool done
+    auto buffer = this->create_buffer(to_send + 13);
     // fixed32 key = 1;
     buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
     // bytes data = 2;
@@ -1067,11 +1087,13 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_length = strlen(line);
+  // LogLevel level and string message
+  auto buffer = this->create_buffer(line_length + 8);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_length);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -1153,6 +1175,53 @@ DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
 #endif
   return resp;
 }
+#ifdef USE_RUNTIME_STATS
+RuntimeStatsResponse APIConnection::runtime_stats(const RuntimeStatsRequest &msg) {
+  RuntimeStatsResponse resp{};
+  resp.uptime = millis();
+  const RuntimeStat &loop = App.get_loop_runtime_stat();
+  resp.loop_count = loop.count;
+  resp.loop_time = loop.total_us;
+  resp.loop_max_time = loop.max_us;
+  resp.loop_histogram_base = Application::LOOP_HISTOGRAM_BASE_US;
+  const uint32_t *histogram = App.get_loop_histogram();
+  resp.loop_histogram.assign(histogram, histogram + Application::LOOP_HISTOGRAM_BUCKETS);
+
+  std::map<Component *, size_t> component_index;
+  for (auto *component : App.get_components()) {
+    const ComponentRuntime &stats = component->get_runtime_stats();
+    component_index[component] = resp.components.size();
+    resp.components.emplace_back();
+    ComponentRuntimeStats &out = resp.components.back();
+    out.source = component->get_component_source();
+    out.setup_time = stats.setup.total_us;
+    out.loop_count = stats.loop.count;
+    out.loop_time = stats.loop.total_us;
+    out.loop_max_time = stats.loop.max_us;
+  }
+
+  for (const auto &item : App.scheduler.get_runtime_stats()) {
+    if (item.stat.count == 0)
+      continue;
+    SchedulerRuntimeStats out;
+    out.source = item.component == nullptr ? "<none>" : item.component->get_component_source();
+    out.name = item.name;
+    out.count = item.stat.count;
+    out.time = item.stat.total_us;
+    out.max_time = item.stat.max_us;
+    resp.scheduler_items.push_back(out);
+
+    auto index = component_index.find(item.component);
+    if (index == component_index.end())
+      continue;
+    ComponentRuntimeStats &component = resp.components[index->second];
+    component.scheduler_count += item.stat.count;
+    component.scheduler_time += item.stat.total_us;
+    component.scheduler_max_time = std::max(component.scheduler_max_time, item.stat.max_us);
+  }
+  return resp;
+}
+#endif
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
   for (auto &it : this->parent_->get_state_subs()) {
     if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
@@ -1174,29 +1243,27 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
-bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
-  if (this->remove_)
+bool APIConnection::try_to_clear_buffer_(bool log_out_of_space) {
+  if (this->helper_->can_write_without_blocking())
+    return true;
+  delay(0);
+  APIError err = this->helper_->loop();
+  if (err != APIError::OK) {
+    on_fatal_error();
+    ESP_LOGW(TAG, "%s: Socket operation failed: %s errno=%d", this->client_combined_info_.c_str(),
+             api_error_to_str(err), errno);
     return false;
+  }
   if (!this->helper_->can_write_without_blocking()) {
-    delay(0);
-    APIError err = this->helper_->loop();
-    if (err != APIError::OK) {
-      on_fatal_error();
-      ESP_LOGW(TAG, "%s: Socket operation failed: %s errno=%d", this->client_combined_info_.c_str(),
-               api_error_to_str(err), errno);
-      return false;
-    }
-    if (!this->helper_->can_write_without_blocking()) {
-      // SubscribeLogsResponse
-      if (message_type != 29) {
-        ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
-      }
-      delay(0);
-      return false;
+    if (log_out_of_space) {
+      ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
     }
+    delay(0);
+    return false;
   }
-
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  return true;
+}
+bool APIConnection::handle_write_error_(APIError err) {
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -1212,6 +1279,81 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
   // Do not set last_traffic_ on send
   return true;
 }
+#ifdef USE_API_BATCH
+// Flush a batch as soon as it fills a TCP segment
+static const size_t API_BATCH_MAX_SIZE = 1400;
+
+static bool is_state_message(uint32_t message_type) {
+  switch (message_type) {
+    case 21:  // BinarySensorStateResponse
+    case 22:  // CoverStateResponse
+    case 23:  // FanStateResponse
+    case 24:  // LightStateResponse
+    case 25:  // SensorStateResponse
+    case 26:  // SwitchStateResponse
+    case 27:  // TextSensorStateResponse
+    case 47:  // ClimateStateResponse
+    case 50:  // NumberStateResponse
+    case 53:  // SelectStateResponse
+    case 59:  // LockStateResponse
+    case 64:  // MediaPlayerStateResponse
+    case 95:  // AlarmControlPanelStateResponse
+    case 98:  // TextStateResponse
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool APIConnection::batch_message_(ProtoWriteBuffer buffer, uint32_t message_type) {
+  // Batch is full and can't be sent yet, let the caller retry like with a full socket
+  if (this->batch_buffer_.size() >= API_BATCH_MAX_SIZE && !this->flush_batch())
+    return false;
+
+  const std::vector<uint8_t> &data = *buffer.get_buffer();
+  if (this->batch_packets_.empty())
+    this->parent_->schedule_batch_flush();
+  this->batch_packets_.push_back(PacketInfo{static_cast<uint16_t>(message_type),
+                                            static_cast<uint32_t>(this->batch_buffer_.size()),
+                                            static_cast<uint32_t>(data.size())});
+  this->batch_buffer_.insert(this->batch_buffer_.end(), data.begin(), data.end());
+
+  if (this->batch_buffer_.size() >= API_BATCH_MAX_SIZE)
+    this->flush_batch();
+  return true;
+}
+
+bool APIConnection::flush_batch() {
+  if (this->batch_packets_.empty() || this->remove_)
+    return true;
+  if (!this->try_to_clear_buffer_(true))
+    return this->remove_;
+
+  APIError err = this->helper_->write_packets(this->batch_packets_, this->batch_buffer_.data());
+  if (err == APIError::WOULD_BLOCK)
+    return false;
+  this->batch_packets_.clear();
+  this->batch_buffer_.clear();
+  return this->handle_write_error_(err);
+}
+#endif
+bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
+  if (this->remove_)
+    return false;
+#ifdef USE_API_BATCH
+  if (this->parent_->get_batch_delay() != 0 && is_state_message(message_type))
+    return this->batch_message_(buffer, message_type);
+  // Keep the message order, queued state messages have to go out first
+  if (!this->flush_batch())
+    return false;
+#endif
+  // SubscribeLogsResponse
+  if (!this->try_to_clear_buffer_(message_type != 29))
+    return false;
+
+  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  return this->handle_write_error_(err);
+}
 void APIConnection::on_unauthenticated_access() {
   this->on_fatal_error();
   ESP_LOGD(TAG, "%s: tried to access without authentication.", this->client_combined_info_.c_str());
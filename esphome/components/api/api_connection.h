@@ -20,6 +20,10 @@ class APIConnection : public APIServerConnection {
 
   void start();
   void loop();
+#ifdef USE_TICKLESS_IDLE
+  /// Whether loop() has nothing to do until the client sends something, see Component::can_idle().
+  bool can_idle();
+#endif
 
   bool send_list_info_done() {
     ListEntitiesDoneResponse resp;
@@ -170,6 +174,9 @@ class APIConnection : public APIServerConnection {
     return {};
   }
   void execute_service(const ExecuteServiceRequest &msg) override;
+#ifdef USE_RUNTIME_STATS
+  RuntimeStatsResponse runtime_stats(const RuntimeStatsRequest &msg) override;
+#endif
 
   bool is_authenticated() override { return this->connection_state_ == ConnectionState::AUTHENTICATED; }
   bool is_connection_setup() override {
@@ -178,12 +185,17 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
     // FIXME: ensure no recursive writes can happen
     this->proto_write_buffer_.clear();
+    this->proto_write_buffer_.reserve(reserve_size);
     return {&this->proto_write_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
+#ifdef USE_API_BATCH
+  /// Send all queued state messages, returns false if they have to stay queued because the socket is full.
+  bool flush_batch();
+#endif
 
   std::string get_client_combined_info() const { return this->client_combined_info_; }
 
@@ -191,6 +203,11 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+  bool try_to_clear_buffer_(bool log_out_of_space);
+  bool handle_write_error_(APIError err);
+#ifdef USE_API_BATCH
+  bool batch_message_(ProtoWriteBuffer buffer, uint32_t message_type);
+#endif
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -204,6 +221,11 @@ class APIConnection : public APIServerConnection {
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
   std::unique_ptr<APIFrameHelper> helper_;
+#ifdef USE_API_BATCH
+  // Encoded state messages waiting for the batch delay or a full batch
+  std::vector<uint8_t> batch_buffer_;
+  std::vector<PacketInfo> batch_packets_;
+#endif
 
   std::string client_info_;
   std::string client_peername_;
@@ -20,6 +20,49 @@ bool is_would_block(ssize_t ret) {
   return ret == 0;
 }
 
+/// Number of frames in a row that have to fit the configured buffer size before a grown buffer shrinks back.
+static const uint8_t BUFFER_SHRINK_FRAMES = 16;
+
+/** Whether a buffer that grew beyond the configured buffer size should shrink back.
+ *
+ * Only after BUFFER_SHRINK_FRAMES frames in a row fit, so that connections that regularly send large messages (batches,
+ * camera images) keep the grown buffer instead of reallocating it for every one of them.
+ */
+static bool should_shrink(size_t used, size_t allocated, size_t buffer_size, uint8_t &small_frames) {
+  if (allocated <= buffer_size)
+    return false;
+  if (used > buffer_size) {
+    small_frames = 0;
+    return false;
+  }
+  if (++small_frames < BUFFER_SHRINK_FRAMES)
+    return false;
+  small_frames = 0;
+  return true;
+}
+
+/** Make room for a frame of `needed` bytes in a receive buffer, called before the first byte of a frame is read.
+ *
+ * Frames bigger than the configured buffer size grow the buffer, see should_shrink() for when it shrinks back.
+ */
+static void prepare_rx_buf(std::vector<uint8_t> &buf, size_t needed, size_t buffer_size, uint8_t &small_frames) {
+  if (needed > buf.size()) {
+    buf.resize(needed);
+    small_frames = 0;
+  } else if (should_shrink(needed, buf.size(), buffer_size, small_frames)) {
+    buf.resize(buffer_size);
+    buf.shrink_to_fit();
+  }
+}
+
+/// Give back the memory of a drained transmit buffer that grew beyond the configured buffer size for `queued` bytes.
+static void release_tx_buf(std::vector<uint8_t> &buf, size_t queued, size_t buffer_size, uint8_t &small_frames) {
+  if (buf.empty() && should_shrink(queued, buf.capacity(), buffer_size, small_frames)) {
+    std::vector<uint8_t>().swap(buf);
+    buf.reserve(buffer_size);
+  }
+}
+
 const char *api_error_to_str(APIError err) {
   // not using switch to ensure compiler doesn't try to build a big table out of it
   if (err == APIError::OK) {
@@ -142,6 +185,9 @@ APIError APINoiseFrameHelper::init() {
   // init prologue
   prologue_.insert(prologue_.end(), PROLOGUE_INIT, PROLOGUE_INIT + strlen(PROLOGUE_INIT));
 
+  rx_buf_.resize(buffer_size_);
+  tx_buf_.reserve(buffer_size_);
+
   state_ = State::CLIENT_HELLO;
   return APIError::OK;
 }
@@ -225,8 +271,8 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
   }
 
   // reserve space for body
-  if (rx_buf_.size() != msg_size) {
-    rx_buf_.resize(msg_size);
+  if (rx_buf_len_ == 0) {
+    prepare_rx_buf(rx_buf_, msg_size, buffer_size_, rx_small_frames_);
   }
 
   if (rx_buf_len_ < msg_size) {
@@ -254,11 +300,11 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
 
   // uncomment for even more debugging
 #ifdef HELPER_LOG_PACKETS
-  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
+  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_.data(), msg_size).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
+  frame->msg = rx_buf_.data();
+  frame->msg_len = msg_size;
   // consume msg
-  rx_buf_ = {};
   rx_buf_len_ = 0;
   rx_header_buf_len_ = 0;
   return APIError::OK;
@@ -295,9 +341,9 @@ APIError APINoiseFrameHelper::state_action_() {
     if (aerr != APIError::OK)
       return aerr;
     // ignore contents, may be used in future for flags
-    prologue_.push_back((uint8_t) (frame.msg.size() >> 8));
-    prologue_.push_back((uint8_t) frame.msg.size());
-    prologue_.insert(prologue_.end(), frame.msg.begin(), frame.msg.end());
+    prologue_.push_back((uint8_t) (frame.msg_len >> 8));
+    prologue_.push_back((uint8_t) frame.msg_len);
+    prologue_.insert(prologue_.end(), frame.msg, frame.msg + frame.msg_len);
 
     state_ = State::SERVER_HELLO;
   }
@@ -340,7 +386,7 @@ APIError APINoiseFrameHelper::state_action_() {
       if (aerr != APIError::OK)
         return aerr;
 
-      if (frame.msg.empty()) {
+      if (frame.msg_len == 0) {
         send_explicit_handshake_reject_("Empty handshake message");
         return APIError::BAD_HANDSHAKE_ERROR_BYTE;
       } else if (frame.msg[0] != 0x00) {
@@ -351,7 +397,7 @@ APIError APINoiseFrameHelper::state_action_() {
 
       NoiseBuffer mbuf;
       noise_buffer_init(mbuf);
-      noise_buffer_set_input(mbuf, frame.msg.data() + 1, frame.msg.size() - 1);
+      noise_buffer_set_input(mbuf, frame.msg + 1, frame.msg_len - 1);
       err = noise_handshakestate_read_message(handshake_, &mbuf, nullptr);
       if (err != 0) {
         state_ = State::FAILED;
@@ -432,7 +478,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, frame.msg.data(), frame.msg.size(), frame.msg.size());
+  noise_buffer_set_inout(mbuf, frame.msg, frame.msg_len, frame.msg_len);
   err = noise_cipherstate_decrypt(recv_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -441,7 +487,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   }
 
   size_t msg_size = mbuf.size;
-  uint8_t *msg_data = frame.msg.data();
+  uint8_t *msg_data = frame.msg;
   if (msg_size < 4) {
     state_ = State::FAILED;
     HELPER_LOG("Bad data packet: size %d too short", msg_size);
@@ -460,14 +506,21 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
     return APIError::BAD_DATA_PACKET;
   }
 
-  buffer->container = std::move(frame.msg);
-  buffer->data_offset = 4;
+  // decrypted in place, the message is handed out without copying
+  buffer->data = msg_data + 4;
   buffer->data_len = data_len;
   buffer->type = type;
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
 APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+  PacketInfo packet{type, 0, static_cast<uint32_t>(payload_len)};
+  return write_packets_(&packet, 1, payload);
+}
+APIError APINoiseFrameHelper::write_packets(const std::vector<PacketInfo> &packets, const uint8_t *data) {
+  return write_packets_(packets.data(), packets.size(), data);
+}
+APIError APINoiseFrameHelper::write_packets_(const PacketInfo *packets, size_t count, const uint8_t *data) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -478,52 +531,67 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   if (state_ != State::DATA) {
     return APIError::WOULD_BLOCK;
   }
-
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  if (count == 0) {
+    return APIError::OK;
   }
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
-  const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  const size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  size_t total_len = 0;
+  for (size_t i = 0; i < count; i++)
+    total_len += 3 + 4 + packets[i].payload_size + mac_len;
+
+  // Every message gets its own frame, encrypted in place at the end of tx_buf_ behind anything still waiting to be
+  // sent. All frames then go out with a single write.
+  const size_t start = tx_buf_.size();
+  tx_buf_.resize(start + total_len);
+  size_t frame_offset = start;
+  for (size_t i = 0; i < count; i++) {
+    const uint16_t type = packets[i].message_type;
+    const size_t payload_len = packets[i].payload_size;
+    const uint8_t *payload = data + packets[i].offset;
+    size_t padding = 0;
+    size_t msg_len = 4 + payload_len + padding;
+    size_t frame_len = 3 + msg_len + mac_len;
+    uint8_t *frame = &tx_buf_[frame_offset];
+
+    frame[0] = 0x01;  // indicator
+    // frame[1], frame[2] to be set later
+    const uint8_t msg_offset = 3;
+    const uint8_t payload_offset = msg_offset + 4;
+    frame[msg_offset + 0] = (uint8_t) (type >> 8);  // type
+    frame[msg_offset + 1] = (uint8_t) type;
+    frame[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
+    frame[msg_offset + 3] = (uint8_t) payload_len;
+    // copy data
+    std::copy(payload, payload + payload_len, &frame[payload_offset]);
+    // fill padding with zeros
+    std::fill(&frame[payload_offset + payload_len], &frame[frame_len], 0);
+
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, &frame[msg_offset], msg_len, frame_len - msg_offset);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      tx_buf_.resize(start);
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    frame[1] = (uint8_t) (mbuf.size >> 8);
+    frame[2] = (uint8_t) mbuf.size;
+    frame_offset += 3 + mbuf.size;
   }
+  tx_buf_.resize(frame_offset);
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
-
-  struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
-  iov.iov_len = total_len;
-
-  // write raw to not have two packets sent if NAGLE disabled
-  return write_raw_(&iov, 1);
+#ifdef HELPER_LOG_PACKETS
+  ESP_LOGVV(TAG, "Sending raw: %s", format_hex_pretty(&tx_buf_[start], frame_offset - start).c_str());
+#endif
+  return try_send_tx_buf_();
 }
 APIError APINoiseFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
+  const size_t queued = tx_buf_.size();
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
     ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
     if (sent == -1) {
@@ -535,10 +603,9 @@ APIError APINoiseFrameHelper::try_send_tx_buf_() {
     } else if (sent == 0) {
       break;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
     tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
   }
+  release_tx_buf(tx_buf_, queued, buffer_size_, tx_small_frames_);
 
   return APIError::OK;
 }
@@ -764,6 +831,9 @@ APIError APIPlaintextFrameHelper::init() {
     return APIError::TCP_NODELAY_FAILED;
   }
 
+  rx_buf_.resize(buffer_size_);
+  tx_buf_.reserve(buffer_size_);
+
   state_ = State::DATA;
   return APIError::OK;
 }
@@ -844,8 +914,8 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
   // header reading done
 
   // reserve space for body
-  if (rx_buf_.size() != rx_header_parsed_len_) {
-    rx_buf_.resize(rx_header_parsed_len_);
+  if (rx_buf_len_ == 0) {
+    prepare_rx_buf(rx_buf_, rx_header_parsed_len_, buffer_size_, rx_small_frames_);
   }
 
   if (rx_buf_len_ < rx_header_parsed_len_) {
@@ -873,11 +943,11 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
 
   // uncomment for even more debugging
 #ifdef HELPER_LOG_PACKETS
-  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
+  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_.data(), rx_header_parsed_len_).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
+  frame->msg = rx_buf_.data();
+  frame->msg_len = rx_header_parsed_len_;
   // consume msg
-  rx_buf_ = {};
   rx_buf_len_ = 0;
   rx_header_buf_.clear();
   rx_header_parsed_ = false;
@@ -896,36 +966,45 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   if (aerr != APIError::OK)
     return aerr;
 
-  buffer->container = std::move(frame.msg);
-  buffer->data_offset = 0;
-  buffer->data_len = rx_header_parsed_len_;
+  buffer->data = frame.msg;
+  buffer->data_len = frame.msg_len;
   buffer->type = rx_header_parsed_type_;
   return APIError::OK;
 }
 bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
 APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+  PacketInfo packet{type, 0, static_cast<uint32_t>(payload_len)};
+  return write_packets_(&packet, 1, payload);
+}
+APIError APIPlaintextFrameHelper::write_packets(const std::vector<PacketInfo> &packets, const uint8_t *data) {
+  return write_packets_(packets.data(), packets.size(), data);
+}
+APIError APIPlaintextFrameHelper::write_packets_(const PacketInfo *packets, size_t count, const uint8_t *data) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
-
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+  // Frames are assembled at the end of tx_buf_ behind anything still waiting to be sent, all of them then go out
+  // with a single write.
+#ifdef HELPER_LOG_PACKETS
+  const size_t start = tx_buf_.size();
+#endif
+  for (size_t i = 0; i < count; i++) {
+    const uint8_t *payload = data + packets[i].offset;
+    tx_buf_.push_back(0x00);
+    ProtoVarInt(packets[i].payload_size).encode(tx_buf_);
+    ProtoVarInt(packets[i].message_type).encode(tx_buf_);
+    tx_buf_.insert(tx_buf_.end(), payload, payload + packets[i].payload_size);
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+#ifdef HELPER_LOG_PACKETS
+  ESP_LOGVV(TAG, "Sending raw: %s", format_hex_pretty(&tx_buf_[start], tx_buf_.size() - start).c_str());
+#endif
+  return try_send_tx_buf_();
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
+  const size_t queued = tx_buf_.size();
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
     ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
     if (is_would_block(sent)) {
@@ -935,78 +1014,12 @@ APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
     tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
   }
+  release_tx_buf(tx_buf_, queued, buffer_size_, tx_small_frames_);
 
   return APIError::OK;
 }
-/** Write the data to the socket, or buffer it a write would block
- *
- * @param data The data to write
- * @param len The length of data
- */
-APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
-  if (iovcnt == 0)
-    return APIError::OK;
-  APIError aerr;
-
-  size_t total_write_len = 0;
-  for (int i = 0; i < iovcnt; i++) {
-#ifdef HELPER_LOG_PACKETS
-    ESP_LOGVV(TAG, "Sending raw: %s",
-              format_hex_pretty(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len).c_str());
-#endif
-    total_write_len += iov[i].iov_len;
-  }
-
-  if (!tx_buf_.empty()) {
-    // try to empty tx_buf_ first
-    aerr = try_send_tx_buf_();
-    if (aerr != APIError::OK && aerr != APIError::WOULD_BLOCK)
-      return aerr;
-  }
-
-  if (!tx_buf_.empty()) {
-    // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
-    return APIError::OK;
-  }
-
-  ssize_t sent = socket_->writev(iov, iovcnt);
-  if (is_would_block(sent)) {
-    // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
-    return APIError::OK;
-  } else if (sent == -1) {
-    // an error occurred
-    state_ = State::FAILED;
-    HELPER_LOG("Socket write failed with errno %d", errno);
-    return APIError::SOCKET_WRITE_FAILED;
-  } else if ((size_t) sent != total_write_len) {
-    // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
-    }
-    return APIError::OK;
-  }
-  // fully sent
-  return APIError::OK;
-}
 
 APIError APIPlaintextFrameHelper::close() {
   state_ = State::CLOSED;
@@ -16,10 +16,11 @@
 namespace esphome {
 namespace api {
 
+/// A received message, decoded in place in the receive buffer of the frame helper.
 struct ReadPacketBuffer {
-  std::vector<uint8_t> container;
+  // Only valid until the next read_packet() call
+  uint8_t *data;
   uint16_t type;
-  size_t data_offset;
   size_t data_len;
 };
 
@@ -30,6 +31,13 @@ struct PacketBuffer {
   uint8_t data_len;
 };
 
+/// One message of a batch written with APIFrameHelper::write_packets(), located at offset in the shared payload buffer.
+struct PacketInfo {
+  uint16_t message_type;
+  uint32_t offset;
+  uint32_t payload_size;
+};
+
 enum class APIError : int {
   OK = 0,
   WOULD_BLOCK = 1001,
@@ -66,8 +74,11 @@ class APIFrameHelper {
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
   virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  // Write several messages as separate frames, but with a single socket write
+  virtual APIError write_packets(const std::vector<PacketInfo> &packets, const uint8_t *data) = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
+  virtual int get_fd() const = 0;
   virtual APIError close() = 0;
   virtual APIError shutdown(int how) = 0;
   // Give this helper a name for logging
@@ -77,18 +88,21 @@ class APIFrameHelper {
 #ifdef USE_API_NOISE
 class APINoiseFrameHelper : public APIFrameHelper {
  public:
-  APINoiseFrameHelper(std::unique_ptr<socket::Socket> socket, std::shared_ptr<APINoiseContext> ctx)
-      : socket_(std::move(socket)), ctx_(std::move(std::move(ctx))) {}
+  APINoiseFrameHelper(std::unique_ptr<socket::Socket> socket, std::shared_ptr<APINoiseContext> ctx,
+                      size_t buffer_size)
+      : socket_(std::move(socket)), buffer_size_(buffer_size), ctx_(std::move(std::move(ctx))) {}
   ~APINoiseFrameHelper() override;
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const std::vector<PacketInfo> &packets, const uint8_t *data) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
   }
+  int get_fd() const override { return this->socket_->get_fd(); }
   APIError close() override;
   APIError shutdown(int how) override;
   // Give this helper a name for logging
@@ -96,12 +110,15 @@ class APINoiseFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    // Points into rx_buf_, only valid until the next try_read_frame_() call
+    uint8_t *msg;
+    size_t msg_len;
   };
 
   APIError state_action_();
   APIError try_read_frame_(ParsedFrame *frame);
   APIError try_send_tx_buf_();
+  APIError write_packets_(const PacketInfo *packets, size_t count, const uint8_t *data);
   APIError write_frame_(const uint8_t *data, size_t len);
   APIError write_raw_(const struct iovec *iov, int iovcnt);
   APIError init_handshake_();
@@ -109,6 +126,11 @@ class APINoiseFrameHelper : public APIFrameHelper {
   void send_explicit_handshake_reject_(const std::string &reason);
 
   std::unique_ptr<socket::Socket> socket_;
+  // Capacity of rx_buf_ and tx_buf_, they are allocated once and reused for all messages
+  size_t buffer_size_;
+  // Frames in a row that fit buffer_size_ since a buffer grew beyond it
+  uint8_t rx_small_frames_{0};
+  uint8_t tx_small_frames_{0};
 
   std::string info_;
   uint8_t rx_header_buf_[3];
@@ -116,6 +138,7 @@ class APINoiseFrameHelper : public APIFrameHelper {
   std::vector<uint8_t> rx_buf_;
   size_t rx_buf_len_ = 0;
 
+  // Outgoing frames are encrypted in place here, holds what the socket didn't accept yet
   std::vector<uint8_t> tx_buf_;
   std::vector<uint8_t> prologue_;
 
@@ -141,17 +164,20 @@ class APINoiseFrameHelper : public APIFrameHelper {
 #ifdef USE_API_PLAINTEXT
 class APIPlaintextFrameHelper : public APIFrameHelper {
  public:
-  APIPlaintextFrameHelper(std::unique_ptr<socket::Socket> socket) : socket_(std::move(socket)) {}
+  APIPlaintextFrameHelper(std::unique_ptr<socket::Socket> socket, size_t buffer_size)
+      : socket_(std::move(socket)), buffer_size_(buffer_size) {}
   ~APIPlaintextFrameHelper() override = default;
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const std::vector<PacketInfo> &packets, const uint8_t *data) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
   }
+  int get_fd() const override { return this->socket_->get_fd(); }
   APIError close() override;
   APIError shutdown(int how) override;
   // Give this helper a name for logging
@@ -159,14 +185,21 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    // Points into rx_buf_, only valid until the next try_read_frame_() call
+    uint8_t *msg;
+    size_t msg_len;
   };
 
   APIError try_read_frame_(ParsedFrame *frame);
   APIError try_send_tx_buf_();
-  APIError write_raw_(const struct iovec *iov, int iovcnt);
+  APIError write_packets_(const PacketInfo *packets, size_t count, const uint8_t *data);
 
   std::unique_ptr<socket::Socket> socket_;
+  // Capacity of rx_buf_ and tx_buf_, they are allocated once and reused for all messages
+  size_t buffer_size_;
+  // Frames in a row that fit buffer_size_ since a buffer grew beyond it
+  uint8_t rx_small_frames_{0};
+  uint8_t tx_small_frames_{0};
 
   std::string info_;
   std::vector<uint8_t> rx_header_buf_;
@@ -513,6 +513,16 @@ bool APIServerConnectionBase::send_text_state_response(const TextStateResponse &
 #endif
 #ifdef USE_TEXT
 #endif
+#ifdef USE_RUNTIME_STATS
+#endif
+#ifdef USE_RUNTIME_STATS
+bool APIServerConnectionBase::send_runtime_stats_response(const RuntimeStatsResponse &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_runtime_stats_response: %s", msg.dump().c_str());
+#endif
+  return this->send_message_<RuntimeStatsResponse>(msg, 101);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -942,6 +952,17 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       ESP_LOGVV(TAG, "on_text_command_request: %s", msg.dump().c_str());
 #endif
       this->on_text_command_request(msg);
+#endif
+      break;
+    }
+    case 100: {
+#ifdef USE_RUNTIME_STATS
+      RuntimeStatsRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_runtime_stats_request: %s", msg.dump().c_str());
+#endif
+      this->on_runtime_stats_request(msg);
 #endif
       break;
     }
@@ -1380,6 +1401,22 @@ void APIServerConnection::on_alarm_control_panel_command_request(const AlarmCont
   this->alarm_control_panel_command(msg);
 }
 #endif
+#ifdef USE_RUNTIME_STATS
+void APIServerConnection::on_runtime_stats_request(const RuntimeStatsRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  RuntimeStatsResponse ret = this->runtime_stats(msg);
+  if (!this->send_runtime_stats_response(ret)) {
+    this->on_fatal_error();
+  }
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
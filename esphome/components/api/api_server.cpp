@@ -14,6 +14,7 @@
 #endif
 
 #include <algorithm>
+#include <cinttypes>
 
 namespace esphome {
 namespace api {
@@ -66,6 +67,10 @@ void APIServer::setup() {
     return;
   }
 
+#ifdef USE_TICKLESS_IDLE
+  App.register_socket_fd(this->socket_->get_fd());
+#endif
+
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
     logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
@@ -91,6 +96,16 @@ void APIServer::setup() {
   }
 #endif
 }
+#ifdef USE_TICKLESS_IDLE
+bool APIServer::can_idle() {
+  for (auto &client : this->clients_) {
+    if (!client->can_idle())
+      return false;
+  }
+  return true;
+}
+#endif
+
 void APIServer::loop() {
   // Accept new clients
   while (true) {
@@ -104,6 +119,9 @@ void APIServer::loop() {
     auto *conn = new APIConnection(std::move(sock), this);
     clients_.emplace_back(conn);
     conn->start();
+#ifdef USE_TICKLESS_IDLE
+    App.register_socket_fd(conn->helper_->get_fd());
+#endif
   }
 
   // Partition clients into remove and active
@@ -113,6 +131,9 @@ void APIServer::loop() {
   for (auto it = new_end; it != this->clients_.end(); ++it) {
     this->client_disconnected_trigger_->trigger((*it)->client_info_, (*it)->client_peername_);
     ESP_LOGV(TAG, "Removing connection to %s", (*it)->client_info_.c_str());
+#ifdef USE_TICKLESS_IDLE
+    App.unregister_socket_fd((*it)->helper_->get_fd());
+#endif
   }
   // resize vector
   this->clients_.erase(new_end, this->clients_.end());
@@ -138,11 +159,15 @@ void APIServer::loop() {
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Buffer size: %zu bytes", this->buffer_size_);
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
   ESP_LOGCONFIG(TAG, "  Using noise encryption: NO");
 #endif
+#ifdef USE_API_BATCH
+  ESP_LOGCONFIG(TAG, "  Batch delay: %" PRIu32 " ms", this->batch_delay_);
+#endif
 }
 bool APIServer::uses_password() const { return !this->password_.empty(); }
 bool APIServer::check_password(const std::string &password) const {
@@ -316,6 +341,22 @@ const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_sta
 }
 uint16_t APIServer::get_port() const { return this->port_; }
 void APIServer::set_reboot_timeout(uint32_t reboot_timeout) { this->reboot_timeout_ = reboot_timeout; }
+#ifdef USE_API_BATCH
+void APIServer::schedule_batch_flush() {
+  // Don't push the deadline out while messages keep arriving
+  if (this->batch_flush_scheduled_)
+    return;
+  this->batch_flush_scheduled_ = true;
+  this->set_timeout("batch", this->batch_delay_, [this]() {
+    this->batch_flush_scheduled_ = false;
+    for (auto &c : this->clients_) {
+      // Socket is still full, retry after another batch delay
+      if (!c->flush_batch())
+        this->schedule_batch_flush();
+    }
+  });
+}
+#endif
 #ifdef USE_HOMEASSISTANT_TIME
 void APIServer::request_time() {
   for (auto &client : this->clients_) {
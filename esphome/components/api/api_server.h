@@ -25,6 +25,9 @@ class APIServer : public Component, public Controller {
   uint16_t get_port() const;
   float get_setup_priority() const override;
   void loop() override;
+#ifdef USE_TICKLESS_IDLE
+  bool can_idle() override;
+#endif
   void dump_config() override;
   void on_shutdown() override;
   bool check_password(const std::string &password) const;
@@ -32,6 +35,14 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  void set_buffer_size(size_t buffer_size) { this->buffer_size_ = buffer_size; }
+  size_t get_buffer_size() const { return this->buffer_size_; }
+#ifdef USE_API_BATCH
+  void set_batch_delay(uint32_t batch_delay) { this->batch_delay_ = batch_delay; }
+  uint32_t get_batch_delay() const { return this->batch_delay_; }
+  /// Flush the queued state messages of all connections once the batch delay has passed.
+  void schedule_batch_flush();
+#endif
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -110,7 +121,13 @@ class APIServer : public Component, public Controller {
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  // Initial size of the receive, transmit and encode buffer of each connection
+  size_t buffer_size_{512};
   uint32_t last_connected_{0};
+#ifdef USE_API_BATCH
+  uint32_t batch_delay_{0};
+  bool batch_flush_scheduled_{false};
+#endif
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
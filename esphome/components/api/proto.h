@@ -143,6 +143,87 @@ class Proto64Bit {
   const uint64_t value_;
 };
 
+/// Helpers to calculate the encoded size of a message before encoding it, matching ProtoWriteBuffer.
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < (1 << 7))
+      return 1;
+    if (value < (1 << 14))
+      return 2;
+    if (value < (1 << 21))
+      return 3;
+    if (value < (1 << 28))
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    uint32_t size = 1;
+    while (value > 0x7F) {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+
+  static void add_uint32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_int32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force) {
+    if (value < 0) {
+      // negative int32 is always 10 byte long
+      total_size += field_id_size + 10;
+      return;
+    }
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force) {
+    add_uint64_field(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force) {
+    // ZigZag encoding
+    const uint32_t uvalue = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    add_uint32_field(total_size, field_id_size, uvalue, force);
+  }
+  static void add_sint64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force) {
+    const uint64_t uvalue = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    add_uint64_field(total_size, field_id_size, uvalue, force);
+  }
+  static void add_enum_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force) {
+    add_uint32_field(total_size, field_id_size, value, force);
+  }
+  static void add_bool_field(uint32_t &total_size, uint32_t field_id_size, bool value, bool force) {
+    if (!value && !force)
+      return;
+    total_size += field_id_size + 1;
+  }
+  template<uint32_t N>
+  static void add_fixed_field(uint32_t &total_size, uint32_t field_id_size, bool is_nonzero, bool force) {
+    if (!is_nonzero && !force)
+      return;
+    total_size += field_id_size + N;
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const std::string &value, bool force) {
+    if (value.empty() && !force)
+      return;
+    total_size += field_id_size + varint(static_cast<uint32_t>(value.size())) + value.size();
+  }
+  /// Nested messages are always encoded, even when empty.
+  template<class C>
+  static void add_message_object(uint32_t &total_size, uint32_t field_id_size, const C &value, bool force) {
+    uint32_t nested_size = 0;
+    value.calculate_size(nested_size);
+    total_size += field_id_size + varint(nested_size) + nested_size;
+  }
+};
+
 class ProtoWriteBuffer {
  public:
   ProtoWriteBuffer(std::vector<uint8_t> *buffer) : buffer_(buffer) {}
@@ -160,11 +241,10 @@ class ProtoWriteBuffer {
     this->encode_field_raw(field_id, 2);
     this->encode_varint_raw(len);
     auto *data = reinterpret_cast<const uint8_t *>(string);
-    for (size_t i = 0; i < len; i++)
-      this->write(data[i]);
+    this->buffer_->insert(this->buffer_->end(), data, data + len);
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -201,7 +281,7 @@ class ProtoWriteBuffer {
     if (value == 0 && !force)
       return;
 
-    this->encode_field_raw(field_id, 5);
+    this->encode_field_raw(field_id, 1);
     this->write((value >> 0) & 0xFF);
     this->write((value >> 8) & 0xFF);
     this->write((value >> 16) & 0xFF);
@@ -223,7 +303,7 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, force);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -256,15 +336,11 @@ class ProtoWriteBuffer {
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    // Write the length up front, so that the nested message doesn't have to be moved after encoding it
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    this->encode_varint_raw(nested_length);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -276,6 +352,8 @@ class ProtoMessage {
  public:
   virtual ~ProtoMessage() = default;
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the encoded size of this message to `total_size`.
+  virtual void calculate_size(uint32_t &total_size) const = 0;
   void decode(const uint8_t *buffer, size_t length);
 #ifdef HAS_PROTO_MESSAGE_DUMP
   std::string dump() const;
@@ -299,12 +377,14 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
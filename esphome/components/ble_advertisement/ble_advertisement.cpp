@@ -0,0 +1,77 @@
+#include "ble_advertisement.h"
+
+#include <cstdio>
+
+namespace esphome {
+namespace ble_advertisement {
+
+uint64_t AdvertisementView::address_uint64() const {
+  uint64_t address = 0;
+  for (uint8_t i = 0; i < 6; i++)
+    address = (address << 8) | this->address_[i];
+  return address;
+}
+
+std::string AdvertisementView::address_str() const {
+  char mac[24];
+  snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X", this->address_[0], this->address_[1], this->address_[2],
+           this->address_[3], this->address_[4], this->address_[5]);
+  return mac;
+}
+
+DataView AdvertisementView::get_name() const {
+  DataView name;
+  this->for_each_record([&name](uint8_t type, const uint8_t *data, uint8_t length) {
+    if ((type == AD_TYPE_NAME_SHORT || type == AD_TYPE_NAME_CMPL) && length > name.size)
+      name = DataView{data, length};
+  });
+  return name;
+}
+
+optional<int8_t> AdvertisementView::get_tx_power() const {
+  optional<int8_t> tx_power;
+  this->for_each_record([&tx_power](uint8_t type, const uint8_t *data, uint8_t length) {
+    if (type == AD_TYPE_TX_PWR && length >= 1 && !tx_power.has_value())
+      tx_power = int8_t(data[0]);
+  });
+  return tx_power;
+}
+
+optional<uint16_t> AdvertisementView::get_appearance() const {
+  optional<uint16_t> appearance;
+  this->for_each_record([&appearance](uint8_t type, const uint8_t *data, uint8_t length) {
+    if (type == AD_TYPE_APPEARANCE && length >= 2)
+      appearance = uint16_t(data[0] | (data[1] << 8));
+  });
+  return appearance;
+}
+
+optional<uint8_t> AdvertisementView::get_ad_flag() const {
+  optional<uint8_t> ad_flag;
+  this->for_each_record([&ad_flag](uint8_t type, const uint8_t *data, uint8_t length) {
+    if (type == AD_TYPE_FLAG && length >= 1)
+      ad_flag = data[0];
+  });
+  return ad_flag;
+}
+
+optional<ServiceDataView> AdvertisementView::find_service_data(uint16_t uuid16) const {
+  optional<ServiceDataView> found;
+  this->for_each_service_data([&found, uuid16](const ServiceDataView &service_data) {
+    if (!found.has_value() && service_data.is_uuid16(uuid16))
+      found = service_data;
+  });
+  return found;
+}
+
+optional<ServiceDataView> AdvertisementView::find_manufacturer_data(uint16_t company_id) const {
+  optional<ServiceDataView> found;
+  this->for_each_manufacturer_data([&found, company_id](const ServiceDataView &manufacturer_data) {
+    if (!found.has_value() && manufacturer_data.is_uuid16(company_id))
+      found = manufacturer_data;
+  });
+  return found;
+}
+
+}  // namespace ble_advertisement
+}  // namespace esphome
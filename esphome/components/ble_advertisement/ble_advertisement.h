@@ -0,0 +1,272 @@
+#pragma once
+
+#include "esphome/core/optional.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace ble_advertisement {
+
+// AD types from the Generic Access Profile assigned numbers, the same values as ESP_BLE_AD_TYPE_* of ESP-IDF.
+static const uint8_t AD_TYPE_FLAG = 0x01;
+static const uint8_t AD_TYPE_16SRV_PART = 0x02;
+static const uint8_t AD_TYPE_16SRV_CMPL = 0x03;
+static const uint8_t AD_TYPE_32SRV_PART = 0x04;
+static const uint8_t AD_TYPE_32SRV_CMPL = 0x05;
+static const uint8_t AD_TYPE_128SRV_PART = 0x06;
+static const uint8_t AD_TYPE_128SRV_CMPL = 0x07;
+static const uint8_t AD_TYPE_NAME_SHORT = 0x08;
+static const uint8_t AD_TYPE_NAME_CMPL = 0x09;
+static const uint8_t AD_TYPE_TX_PWR = 0x0A;
+static const uint8_t AD_TYPE_INT_RANGE = 0x12;
+static const uint8_t AD_TYPE_SERVICE_DATA = 0x16;
+static const uint8_t AD_TYPE_APPEARANCE = 0x19;
+static const uint8_t AD_TYPE_32SERVICE_DATA = 0x20;
+static const uint8_t AD_TYPE_128SERVICE_DATA = 0x21;
+static const uint8_t AD_TYPE_MANUFACTURER_SPECIFIC = 0xFF;
+
+/// A range of bytes inside an advertisement, only valid as long as the advertisement it points into.
+struct DataView {
+  const uint8_t *data{nullptr};
+  uint8_t size{0};
+
+  const uint8_t *begin() const { return this->data; }
+  const uint8_t *end() const { return this->data + this->size; }
+  bool empty() const { return this->size == 0; }
+  uint8_t operator[](size_t index) const { return this->data[index]; }
+};
+
+/// Service or manufacturer data. The UUID is little endian with 2, 4 or 16 bytes, for manufacturer data it's the
+/// 16-bit company identifier.
+struct ServiceDataView {
+  DataView uuid;
+  DataView data;
+
+  /// Whether the UUID is the given 16-bit UUID (or company identifier).
+  bool is_uuid16(uint16_t uuid16) const {
+    return this->uuid.size == 2 && (this->uuid[0] | (this->uuid[1] << 8)) == uuid16;
+  }
+};
+
+/** Call callback(type, data, length) for every AD structure in advertising data.
+ *
+ * Zero length padding is skipped, and parsing stops at a structure that runs past the end of the data.
+ */
+template<typename F> void for_each_record(const uint8_t *payload, size_t length, F &&callback) {
+  size_t offset = 0;
+  while (offset + 2 < length) {
+    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
+    if (field_length == 0)
+      continue;  // Possible zero padded advertisement data
+    const uint8_t record_length = field_length - 1;
+    if (offset + field_length > length)
+      return;
+    // first byte of adv record is adv record type
+    const uint8_t record_type = payload[offset++];
+    callback(record_type, &payload[offset], record_length);
+    offset += record_length;
+  }
+}
+
+/** A parsed advertisement that doesn't copy or allocate anything.
+ *
+ * All data is returned as views into the advertising data the view was created with, so they are only valid as long
+ * as that is. Every getter walks the AD structures again, which is cheap for the at most 62 bytes of an advertisement
+ * and scan response.
+ */
+class AdvertisementView {
+ public:
+  AdvertisementView(const uint8_t *address, uint8_t address_type, int rssi, const uint8_t *payload, uint8_t length)
+      : address_(address), address_type_(address_type), rssi_(rssi), payload_(payload), length_(length) {}
+
+  /// The 6 address bytes, most significant first.
+  const uint8_t *address() const { return this->address_; }
+  uint64_t address_uint64() const;
+  std::string address_str() const;
+  uint8_t get_address_type() const { return this->address_type_; }
+  int get_rssi() const { return this->rssi_; }
+  /// The advertising data followed by the scan response.
+  DataView get_payload() const { return DataView{this->payload_, this->length_}; }
+
+  /// Call callback(type, data, length) for every AD structure.
+  template<typename F> void for_each_record(F &&callback) const {
+    ble_advertisement::for_each_record(this->payload_, this->length_, callback);
+  }
+
+  /// The longest of the complete and shortened local names, empty if there is none.
+  DataView get_name() const;
+  optional<int8_t> get_tx_power() const;
+  optional<uint16_t> get_appearance() const;
+  optional<uint8_t> get_ad_flag() const;
+
+  /// Call callback(uuid) with a DataView of every advertised service UUID.
+  template<typename F> void for_each_service_uuid(F &&callback) const {
+    this->for_each_record([&callback](uint8_t type, const uint8_t *data, uint8_t length) {
+      uint8_t size;
+      switch (type) {
+        case AD_TYPE_16SRV_CMPL:
+        case AD_TYPE_16SRV_PART:
+          size = 2;
+          break;
+        case AD_TYPE_32SRV_CMPL:
+        case AD_TYPE_32SRV_PART:
+          size = 4;
+          break;
+        case AD_TYPE_128SRV_CMPL:
+        case AD_TYPE_128SRV_PART:
+          size = 16;
+          break;
+        default:
+          return;
+      }
+      for (uint8_t i = 0; i + size <= length; i += size)
+        callback(DataView{data + i, size});
+    });
+  }
+  /// Call callback(service_data) for every service data structure.
+  template<typename F> void for_each_service_data(F &&callback) const {
+    this->for_each_record([&callback](uint8_t type, const uint8_t *data, uint8_t length) {
+      uint8_t uuid_size;
+      switch (type) {
+        case AD_TYPE_SERVICE_DATA:
+          uuid_size = 2;
+          break;
+        case AD_TYPE_32SERVICE_DATA:
+          uuid_size = 4;
+          break;
+        case AD_TYPE_128SERVICE_DATA:
+          uuid_size = 16;
+          break;
+        default:
+          return;
+      }
+      if (length >= uuid_size)
+        callback(ServiceDataView{DataView{data, uuid_size}, DataView{data + uuid_size, uint8_t(length - uuid_size)}});
+    });
+  }
+  /// Call callback(manufacturer_data) for every manufacturer specific data structure.
+  template<typename F> void for_each_manufacturer_data(F &&callback) const {
+    this->for_each_record([&callback](uint8_t type, const uint8_t *data, uint8_t length) {
+      if (type == AD_TYPE_MANUFACTURER_SPECIFIC && length >= 2)
+        callback(ServiceDataView{DataView{data, 2}, DataView{data + 2, uint8_t(length - 2)}});
+    });
+  }
+
+  /// The first service data with the given 16-bit UUID.
+  optional<ServiceDataView> find_service_data(uint16_t uuid16) const;
+  /// The first manufacturer data of the given company.
+  optional<ServiceDataView> find_manufacturer_data(uint16_t company_id) const;
+
+ protected:
+  const uint8_t *address_;
+  uint8_t address_type_;
+  int rssi_;
+  const uint8_t *payload_;
+  uint8_t length_;
+};
+
+/** An advertisement copied into vectors and strings, the way esp32_ble_tracker::ESPBTDevice keeps it.
+ *
+ * UUID needs from_uint16(), from_uint32() and from_raw() for 128-bit UUIDs, like esp32_ble::ESPBTUUID. ServiceData is
+ * an aggregate of a UUID `uuid` and a std::vector<uint8_t> `data`.
+ */
+template<typename UUID, typename ServiceData> struct ParsedAdvertisement {
+  std::string name;
+  std::vector<int8_t> tx_powers;
+  optional<uint16_t> appearance;
+  optional<uint8_t> ad_flag;
+  std::vector<UUID> service_uuids;
+  std::vector<ServiceData> manufacturer_datas;
+  std::vector<ServiceData> service_datas;
+
+  /// Add the AD structures of the advertising data (and scan response) to the members.
+  void parse(const uint8_t *payload, size_t length) {
+    // See also Generic Access Profile Assigned Numbers:
+    // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
+    // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
+    // See also Core Specification Supplement: https://www.bluetooth.com/specifications/bluetooth-core-specification/
+    // (called CSS here)
+    for_each_record(payload, length, [this](uint8_t type, const uint8_t *record, uint8_t record_length) {
+      switch (type) {
+        case AD_TYPE_NAME_SHORT:
+        case AD_TYPE_NAME_CMPL:
+          // CSS 1.2 LOCAL NAME, the shortened name shall not be longer than the complete one
+          if (record_length > this->name.length())
+            this->name = std::string(reinterpret_cast<const char *>(record), record_length);
+          break;
+        case AD_TYPE_TX_PWR:
+          // CSS 1.5 TX POWER LEVEL, may appear more than once
+          if (record_length >= 1)
+            this->tx_powers.push_back(int8_t(record[0]));
+          break;
+        case AD_TYPE_APPEARANCE:
+          // CSS 1.12 APPEARANCE
+          if (record_length >= 2)
+            this->appearance = uint16_t(record[0] | (record[1] << 8));
+          break;
+        case AD_TYPE_FLAG:
+          // CSS 1.3 FLAGS
+          if (record_length >= 1)
+            this->ad_flag = record[0];
+          break;
+        // CSS 1.1 SERVICE UUID, lists of 16-bit, 32-bit or 128-bit UUIDs
+        case AD_TYPE_16SRV_CMPL:
+        case AD_TYPE_16SRV_PART:
+          for (uint8_t i = 0; i + 2 <= record_length; i += 2)
+            this->service_uuids.push_back(UUID::from_uint16(read_uint16_(record + i)));
+          break;
+        case AD_TYPE_32SRV_CMPL:
+        case AD_TYPE_32SRV_PART:
+          for (uint8_t i = 0; i + 4 <= record_length; i += 4)
+            this->service_uuids.push_back(UUID::from_uint32(read_uint32_(record + i)));
+          break;
+        case AD_TYPE_128SRV_CMPL:
+        case AD_TYPE_128SRV_PART:
+          for (uint8_t i = 0; i + 16 <= record_length; i += 16)
+            this->service_uuids.push_back(UUID::from_raw(record + i));
+          break;
+        // CSS 1.4 MANUFACTURER SPECIFIC DATA, starts with the 16-bit company identifier
+        case AD_TYPE_MANUFACTURER_SPECIFIC:
+          if (record_length >= 2)
+            this->manufacturer_datas.push_back(
+                data_(UUID::from_uint16(read_uint16_(record)), record + 2, record_length - 2));
+          break;
+        // CSS 1.11 SERVICE DATA, the service UUID followed by the data
+        case AD_TYPE_SERVICE_DATA:
+          if (record_length >= 2)
+            this->service_datas.push_back(
+                data_(UUID::from_uint16(read_uint16_(record)), record + 2, record_length - 2));
+          break;
+        case AD_TYPE_32SERVICE_DATA:
+          if (record_length >= 4)
+            this->service_datas.push_back(
+                data_(UUID::from_uint32(read_uint32_(record)), record + 4, record_length - 4));
+          break;
+        case AD_TYPE_128SERVICE_DATA:
+          if (record_length >= 16)
+            this->service_datas.push_back(data_(UUID::from_raw(record), record + 16, record_length - 16));
+          break;
+        default:
+          break;
+      }
+    });
+  }
+
+ protected:
+  static uint16_t read_uint16_(const uint8_t *data) { return data[0] | (data[1] << 8); }
+  static uint32_t read_uint32_(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (uint32_t(data[3]) << 24);
+  }
+  static ServiceData data_(const UUID &uuid, const uint8_t *data, uint8_t length) {
+    ServiceData service_data{};
+    service_data.uuid = uuid;
+    service_data.data.assign(data, data + length);
+    return service_data;
+  }
+};
+
+}  // namespace ble_advertisement
+}  // namespace esphome
@@ -0,0 +1,96 @@
+#include "device_table.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace ble_advertisement {
+
+size_t DeviceTable::slot_(uint64_t address) const {
+  // Fibonacci hashing, the low bytes of random addresses aren't spread well enough to use directly
+  return ((address * 0x9E3779B97F4A7C15ULL) >> 32) & (this->capacity_ - 1);
+}
+
+DeviceTable::Entry *DeviceTable::find(uint64_t address) {
+  if (this->size_ == 0)
+    return nullptr;
+  for (size_t i = this->slot_(address);; i = (i + 1) & (this->capacity_ - 1)) {
+    Entry &entry = this->entries_[i];
+    if (!entry.used)
+      return nullptr;
+    if (entry.address == address)
+      return &entry;
+  }
+}
+
+DeviceTable::Entry *DeviceTable::insert(uint64_t address, uint32_t now, bool *inserted) {
+  *inserted = false;
+  Entry *found = this->find(address);
+  if (found != nullptr)
+    return found;
+
+  if (this->entries_ == nullptr) {
+    this->capacity_ = 4;
+    while (this->capacity_ * 3 < this->max_devices_ * 4u)
+      this->capacity_ *= 2;
+    this->entries_.reset(new Entry[this->capacity_]);  // NOLINT
+    this->clear();
+  }
+
+  if (this->size_ >= this->max_devices_) {
+    // Replace the device that was seen least recently
+    size_t oldest = this->capacity_;
+    for (size_t i = 0; i < this->capacity_; i++) {
+      const Entry &entry = this->entries_[i];
+      if (entry.used && (oldest == this->capacity_ || now - entry.last_seen > now - this->entries_[oldest].last_seen))
+        oldest = i;
+    }
+    this->erase_(oldest);
+  }
+
+  size_t i = this->slot_(address);
+  while (this->entries_[i].used)
+    i = (i + 1) & (this->capacity_ - 1);
+  Entry &entry = this->entries_[i];
+  memset(&entry, 0, sizeof(entry));
+  entry.address = address;
+  entry.last_seen = now;
+  entry.used = true;
+  this->size_++;
+  *inserted = true;
+  return &entry;
+}
+
+void DeviceTable::erase_(size_t index) {
+  // Backward shift deletion: move later entries of the same probe sequence into the hole, so that find() can stop at
+  // the first unused slot without tombstones
+  const size_t mask = this->capacity_ - 1;
+  size_t hole = index;
+  for (size_t i = (index + 1) & mask; this->entries_[i].used; i = (i + 1) & mask) {
+    const size_t home = this->slot_(this->entries_[i].address);
+    // Only move the entry if its home slot isn't between the hole and the entry (cyclically)
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      this->entries_[hole] = this->entries_[i];
+      hole = i;
+    }
+  }
+  this->entries_[hole].used = false;
+  this->size_--;
+}
+
+void DeviceTable::clear() {
+  for (size_t i = 0; i < this->capacity_; i++)
+    this->entries_[i].used = false;
+  this->size_ = 0;
+}
+
+uint32_t DeviceTable::hash_payload(const uint8_t *payload, size_t length) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= payload[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+}  // namespace ble_advertisement
+}  // namespace esphome
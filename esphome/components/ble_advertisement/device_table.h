@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace ble_advertisement {
+
+/** A fixed capacity table with the last advertisement of every nearby device, keyed by MAC address.
+ *
+ * Uses open addressing with linear probing, so lookups don't allocate and stay fast with hundreds of devices. When the
+ * table is full, the device that was seen least recently is replaced.
+ */
+class DeviceTable {
+ public:
+  struct Entry {
+    uint64_t address;
+    /// Hashes of the last advertising data and scan response, see hash_payload().
+    uint32_t payload_hash;
+    uint32_t scan_response_hash;
+    /// Lengths of the last advertising data and scan response, compared along with the hashes.
+    uint8_t payload_length;
+    uint8_t scan_response_length;
+    /// millis() when the device was last seen.
+    uint32_t last_seen;
+    /// millis() when the last advertisement was passed on to the listeners.
+    uint32_t last_dispatched;
+    int8_t rssi;
+    /// Number of the scan the device was last seen in.
+    uint8_t scan;
+    /// Whether the device has been logged in the scan it was last seen in.
+    bool printed;
+    bool used;
+  };
+
+  /// Create a table for up to max_devices devices, no memory is allocated until the first insert().
+  explicit DeviceTable(uint16_t max_devices) : max_devices_(max_devices) {}
+
+  /// The entry of the device, or nullptr if it isn't in the table.
+  Entry *find(uint64_t address);
+  /** The entry of the device, which is added if it isn't in the table yet.
+   *
+   * New entries are zeroed apart from the address and last_seen, which is set to now. *inserted is set to whether the
+   * device was added.
+   */
+  Entry *insert(uint64_t address, uint32_t now, bool *inserted);
+  void clear();
+
+  uint16_t size() const { return this->size_; }
+  uint16_t get_max_devices() const { return this->max_devices_; }
+
+  /// FNV-1a hash of an advertisement payload.
+  static uint32_t hash_payload(const uint8_t *payload, size_t length);
+
+ protected:
+  size_t slot_(uint64_t address) const;
+  void erase_(size_t index);
+
+  uint16_t max_devices_;
+  uint16_t size_{0};
+  /// Number of slots, a power of two with at most 75% of them used.
+  size_t capacity_{0};
+  std::unique_ptr<Entry[]> entries_;
+};
+
+}  // namespace ble_advertisement
+}  // namespace esphome
@@ -0,0 +1,100 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_DURATION,
+    CONF_FILE,
+    CONF_ID,
+    CONF_RAW_DATA_ID,
+    PLATFORM_HOST,
+)
+from esphome.core import CORE, HexInt
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["logger"]
+AUTO_LOAD = ["ble_advertisement"]
+
+CONF_LISTENERS = "listeners"
+CONF_BATCH_SIZE = "batch_size"
+
+# Advertising data plus scan response, like ESP_BLE_ADV_DATA_LEN_MAX + ESP_BLE_SCAN_RSP_DATA_LEN_MAX
+MAX_PAYLOAD_LENGTH = 62
+
+ble_replay_ns = cg.esphome_ns.namespace("ble_replay")
+BLEReplay = ble_replay_ns.class_("BLEReplay", cg.PollingComponent)
+
+
+def parse_capture(path):
+    """Parse a capture with one advertisement per line: `<address> <rssi> <payload in hex>`.
+
+    Empty lines and everything after a `#` are ignored.
+    """
+    adverts = []
+    with open(path, encoding="utf-8") as f:
+        for line_number, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split()
+            if len(parts) != 3:
+                raise cv.Invalid(
+                    f"{path}:{line_number}: expected '<address> <rssi> <payload>'"
+                )
+            try:
+                address = cv.mac_address(parts[0])
+                rssi = int(parts[1])
+                payload = bytes.fromhex(parts[2])
+            except (cv.Invalid, ValueError) as err:
+                raise cv.Invalid(f"{path}:{line_number}: {err}") from err
+            if not -128 <= rssi <= 127:
+                raise cv.Invalid(f"{path}:{line_number}: RSSI {rssi} out of range")
+            if len(payload) > MAX_PAYLOAD_LENGTH:
+                raise cv.Invalid(
+                    f"{path}:{line_number}: payload longer than {MAX_PAYLOAD_LENGTH} bytes"
+                )
+            adverts.append((address.parts, rssi, payload))
+    if not adverts:
+        raise cv.Invalid(f"{path}: no advertisements found")
+    return adverts
+
+
+def validate_capture(value):
+    parse_capture(CORE.relative_config_path(value))
+    return value
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(BLEReplay),
+            cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+            cv.Required(CONF_FILE): cv.All(cv.file_, validate_capture),
+            cv.Optional(CONF_LISTENERS, default=10): cv.int_range(min=1, max=255),
+            cv.Optional(CONF_BATCH_SIZE, default=16): cv.int_range(min=1, max=1000),
+            cv.Optional(CONF_DURATION): cv.positive_time_period_milliseconds,
+        }
+    ).extend(cv.polling_component_schema("10s")),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    adverts = parse_capture(CORE.relative_config_path(config[CONF_FILE]))
+
+    # Every advertisement is stored as address, RSSI, length and payload
+    data = []
+    for address, rssi, payload in adverts:
+        data += address
+        data.append(rssi & 0xFF)
+        data.append(len(payload))
+        data += payload
+    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], [HexInt(x) for x in data])
+
+    var = cg.new_Pvariable(config[CONF_ID], prog_arr, len(adverts))
+    await cg.register_component(var, config)
+    # Replace operator new of the host platform with one that counts allocations
+    cg.add_define("USE_HOST_HEAP_COUNTER")
+
+    cg.add(var.set_num_listeners(config[CONF_LISTENERS]))
+    cg.add(var.set_batch_size(config[CONF_BATCH_SIZE]))
+    if CONF_DURATION in config:
+        cg.add(var.set_duration(config[CONF_DURATION]))
@@ -0,0 +1,188 @@
+#include "ble_replay.h"
+
+#include "esphome/components/ble_advertisement/ble_advertisement.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
+
+#ifdef USE_HOST_HEAP_COUNTER
+#include "esphome/components/host/core.h"
+#endif
+
+namespace esphome {
+namespace ble_replay {
+
+static const char *const TAG = "ble_replay";
+
+using namespace ble_advertisement;
+
+/// Stand-in for esp32_ble::ESPBTUUID, which needs ESP-IDF. Like it, the UUID is stored inline.
+struct ReplayUUID {
+  uint8_t size;
+  uint8_t data[16];
+
+  static ReplayUUID from_uint16(uint16_t uuid) { return from_uint32(uuid, 2); }
+  static ReplayUUID from_uint32(uint32_t uuid, uint8_t size = 4) {
+    ReplayUUID ret{size, {}};
+    for (uint8_t i = 0; i < size; i++)
+      ret.data[i] = uuid >> (8 * i);
+    return ret;
+  }
+  static ReplayUUID from_raw(const uint8_t *data) {
+    ReplayUUID ret{16, {}};
+    memcpy(ret.data, data, 16);
+    return ret;
+  }
+};
+/// Stand-in for esp32_ble_tracker::ServiceData.
+struct ReplayServiceData {
+  ReplayUUID uuid;
+  std::vector<uint8_t> data;
+};
+
+static uint32_t heap_allocations() {
+#ifdef USE_HOST_HEAP_COUNTER
+  return host::get_heap_allocations();
+#else
+  return 0;
+#endif
+}
+
+void BLEReplay::setup() {
+  const uint8_t *data = this->data_;
+  this->adverts_.resize(this->num_adverts_);
+  for (auto &advert : this->adverts_) {
+    for (uint8_t &byte : advert.address)
+      byte = progmem_read_byte(data++);
+    advert.rssi = int8_t(progmem_read_byte(data++));
+    advert.length = progmem_read_byte(data++);
+    for (uint8_t i = 0; i < advert.length; i++)
+      advert.payload[i] = progmem_read_byte(data++);
+  }
+
+  // Spread the listeners over the devices of the capture
+  this->listeners_.resize(this->num_listeners_);
+  for (uint8_t i = 0; i < this->num_listeners_; i++) {
+    const ReplayAdvertisement &advert = this->adverts_[i % this->num_adverts_];
+    uint64_t address = 0;
+    for (uint8_t byte : advert.address)
+      address = (address << 8) | byte;
+    this->listeners_[i].address = address;
+  }
+
+  if (this->duration_ != 0) {
+    this->set_timeout("duration", this->duration_, [this]() {
+      this->update();
+      ESP_LOGI(TAG, "Benchmark finished");
+      App.reboot();
+    });
+  }
+  this->last_report_ = millis();
+}
+
+void BLEReplay::replay_copy_(const ReplayAdvertisement &advert) {
+  // What ESPBTDevice::parse_scan_rst() does for every scan result
+  uint64_t address = 0;
+  for (uint8_t byte : advert.address)
+    address = (address << 8) | byte;
+  ParsedAdvertisement<ReplayUUID, ReplayServiceData> device;
+  device.parse(advert.payload, advert.length);
+
+  for (auto &listener : this->listeners_) {
+    if (listener.address != address)
+      continue;
+    listener.matches++;
+    for (auto &service_data : device.service_datas)
+      listener.service_data_bytes += service_data.data.size();
+  }
+}
+
+void BLEReplay::replay_view_(const ReplayAdvertisement &advert) {
+  const AdvertisementView device(advert.address, 0, advert.rssi, advert.payload, advert.length);
+  const uint64_t address = device.address_uint64();
+
+  for (auto &listener : this->listeners_) {
+    if (listener.address != address)
+      continue;
+    listener.matches++;
+    device.for_each_service_data(
+        [&listener](const ServiceDataView &service_data) { listener.service_data_bytes += service_data.data.size; });
+  }
+}
+
+void BLEReplay::add_result_(ReplayStat &stat) {
+  for (auto &listener : this->listeners_) {
+    stat.matches += listener.matches;
+    stat.service_data_bytes += listener.service_data_bytes;
+    listener.matches = 0;
+    listener.service_data_bytes = 0;
+  }
+}
+
+void BLEReplay::loop() {
+  const size_t start_index = this->index_;
+
+  uint32_t allocations = heap_allocations();
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < this->batch_size_; i++)
+    this->replay_copy_(this->adverts_[(start_index + i) % this->num_adverts_]);
+  this->copy_.time_us += micros() - start;
+  this->copy_.allocations += heap_allocations() - allocations;
+  this->copy_.adverts += this->batch_size_;
+  this->add_result_(this->copy_);
+
+  allocations = heap_allocations();
+  start = micros();
+  for (uint16_t i = 0; i < this->batch_size_; i++)
+    this->replay_view_(this->adverts_[(start_index + i) % this->num_adverts_]);
+  this->view_.time_us += micros() - start;
+  this->view_.allocations += heap_allocations() - allocations;
+  this->view_.adverts += this->batch_size_;
+  this->add_result_(this->view_);
+
+  this->index_ = (start_index + this->batch_size_) % this->num_adverts_;
+}
+
+void BLEReplay::log_stat_(const char *name, const ReplayStat &stat) {
+  if (stat.adverts == 0 || stat.time_us == 0)
+    return;
+  ESP_LOGI(TAG, "  %s: %.0f adverts/s, %.2f us and %.2f heap allocations per advert", name,
+           stat.adverts * 1e6f / stat.time_us, float(stat.time_us) / stat.adverts,
+           float(stat.allocations) / stat.adverts);
+}
+
+void BLEReplay::update() {
+  const uint32_t now = millis();
+  const float elapsed = (now - this->last_report_) / 1000.0f;
+  if (elapsed <= 0.0f)
+    return;
+
+  ESP_LOGI(TAG, "Report for the last %.1fs, %" PRIu32 " adverts:", elapsed, this->view_.adverts);
+  this->log_stat_("Copy", this->copy_);
+  this->log_stat_("View", this->view_);
+  if (this->copy_.matches != this->view_.matches || this->copy_.service_data_bytes != this->view_.service_data_bytes) {
+    ESP_LOGW(TAG, "  Listener results differ: copy %" PRIu32 " matches/%" PRIu32 " bytes, view %" PRIu32
+                  " matches/%" PRIu32 " bytes",
+             this->copy_.matches, this->copy_.service_data_bytes, this->view_.matches, this->view_.service_data_bytes);
+  }
+
+  this->copy_ = ReplayStat{};
+  this->view_ = ReplayStat{};
+  this->last_report_ = now;
+}
+
+void BLEReplay::dump_config() {
+  ESP_LOGCONFIG(TAG, "BLE Replay:");
+  ESP_LOGCONFIG(TAG, "  Advertisements: %zu", this->num_adverts_);
+  ESP_LOGCONFIG(TAG, "  Listeners: %u", this->num_listeners_);
+  ESP_LOGCONFIG(TAG, "  Batch Size: %u", this->batch_size_);
+  if (this->duration_ != 0)
+    ESP_LOGCONFIG(TAG, "  Duration: %" PRIu32 " ms", this->duration_);
+  LOG_UPDATE_INTERVAL(this);
+}
+
+}  // namespace ble_replay
+}  // namespace esphome
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace ble_replay {
+
+/// A scan result as the Bluetooth stack delivers it, advertising data and scan response in one buffer.
+struct ReplayAdvertisement {
+  uint8_t address[6];
+  int8_t rssi;
+  uint8_t length;
+  uint8_t payload[62];
+};
+
+/// Stand-in for a sensor platform like xiaomi_ble, that looks for the service data of one device.
+struct ReplayListener {
+  uint64_t address;
+  uint32_t matches{0};
+  uint32_t service_data_bytes{0};
+};
+
+/// Time, heap allocations and listener results of one way of parsing, reset after every report.
+struct ReplayStat {
+  uint32_t adverts{0};
+  uint64_t time_us{0};
+  uint32_t allocations{0};
+  uint32_t matches{0};
+  uint32_t service_data_bytes{0};
+};
+
+/** Replays a captured BLE advertisement stream through the advertisement parsers on the host platform.
+ *
+ * Every loop it dispatches `batch_size` advertisements of the capture to `num_listeners` listeners twice: once copied
+ * into vectors and strings by ble_advertisement::ParsedAdvertisement, the parser ESPBTDevice uses for every scan
+ * result, and once as an ble_advertisement AdvertisementView. Every `update_interval` it logs the advertisements per second and the heap allocations per
+ * advertisement of both, and whether the listeners saw the same data.
+ */
+class BLEReplay : public PollingComponent {
+ public:
+  BLEReplay(const uint8_t *data, size_t num_adverts) : data_(data), num_adverts_(num_adverts) {}
+
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_num_listeners(uint8_t num_listeners) { this->num_listeners_ = num_listeners; }
+  void set_batch_size(uint16_t batch_size) { this->batch_size_ = batch_size; }
+  void set_duration(uint32_t duration) { this->duration_ = duration; }
+
+ protected:
+  void replay_copy_(const ReplayAdvertisement &advert);
+  void replay_view_(const ReplayAdvertisement &advert);
+  void add_result_(ReplayStat &stat);
+  void log_stat_(const char *name, const ReplayStat &stat);
+
+  const uint8_t *data_;
+  size_t num_adverts_;
+  uint8_t num_listeners_{10};
+  uint16_t batch_size_{16};
+  uint32_t duration_{0};
+
+  std::vector<ReplayAdvertisement> adverts_;
+  std::vector<ReplayListener> listeners_;
+  size_t index_{0};
+
+  ReplayStat copy_;
+  ReplayStat view_;
+  uint32_t last_report_{0};
+};
+
+}  // namespace ble_replay
+}  // namespace esphome
@@ -1,6 +1,7 @@
 #include "debug_component.h"
 
 #include <algorithm>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
@@ -64,6 +65,9 @@ void DebugComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Debug component:");
 #ifdef USE_TEXT_SENSOR
   LOG_TEXT_SENSOR("  ", "Device info", this->device_info_);
+#ifdef USE_RUNTIME_STATS
+  LOG_TEXT_SENSOR("  ", "Busiest component", this->busiest_component_);
+#endif
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   LOG_SENSOR("  ", "Free space on heap", this->free_sensor_);
@@ -72,6 +76,9 @@ void DebugComponent::dump_config() {
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
 #endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
 #endif  // USE_SENSOR
+#ifdef USE_RUNTIME_STATS
+  this->log_runtime_stats_();
+#endif
 
   ESP_LOGD(TAG, "ESPHome version %s", ESPHOME_VERSION);
   device_info += ESPHOME_VERSION;
@@ -440,8 +447,66 @@ void DebugComponent::update() {
   }
 #endif  // USE_ESP32
 #endif  // USE_SENSOR
+
+#if defined(USE_TEXT_SENSOR) && defined(USE_RUNTIME_STATS)
+  if (this->busiest_component_ != nullptr) {
+    const uint32_t now = millis();
+    auto runtimes = this->get_component_runtimes_();
+    Component *busiest = nullptr;
+    uint64_t busiest_time = 0;
+    for (auto &it : runtimes) {
+      const uint64_t time = it.second - this->last_runtimes_[it.first];
+      if (busiest == nullptr || time > busiest_time) {
+        busiest = it.first;
+        busiest_time = time;
+      }
+    }
+    const uint32_t elapsed = now - this->last_runtimes_time_;
+    if (busiest != nullptr && elapsed != 0) {
+      char buf[64];
+      snprintf(buf, sizeof(buf), "%s (%.1f%%)", busiest->get_component_source(), busiest_time / (elapsed * 10.0f));
+      this->busiest_component_->publish_state(buf);
+    }
+    this->last_runtimes_ = std::move(runtimes);
+    this->last_runtimes_time_ = now;
+  }
+#endif
 }
 
+#ifdef USE_RUNTIME_STATS
+std::map<Component *, uint64_t> DebugComponent::get_component_runtimes_() {
+  std::map<Component *, uint64_t> runtimes;
+  for (auto *component : App.get_components())
+    runtimes[component] = component->get_runtime_stats().loop.total_us;
+  for (const auto &item : App.scheduler.get_runtime_stats()) {
+    auto runtime = runtimes.find(item.component);
+    if (runtime != runtimes.end())
+      runtime->second += item.stat.total_us;
+  }
+  return runtimes;
+}
+
+void DebugComponent::log_runtime_stats_() {
+  const RuntimeStat &loop = App.get_loop_runtime_stat();
+  ESP_LOGCONFIG(TAG, "  Runtime stats since boot:");
+  ESP_LOGCONFIG(TAG, "    Main loop: %" PRIu32 " iterations, avg %" PRIu32 " us, max %" PRIu32 " us", loop.count,
+                loop.count == 0 ? 0 : uint32_t(loop.total_us / loop.count), loop.max_us);
+  for (auto *component : App.get_components()) {
+    const ComponentRuntime &stats = component->get_runtime_stats();
+    ESP_LOGCONFIG(TAG, "    %s: setup %" PRIu32 " us, loop avg %" PRIu32 " us, max %" PRIu32 " us",
+                  component->get_component_source(), uint32_t(stats.setup.total_us),
+                  stats.loop.count == 0 ? 0 : uint32_t(stats.loop.total_us / stats.loop.count), stats.loop.max_us);
+  }
+  for (const auto &item : App.scheduler.get_runtime_stats()) {
+    if (item.stat.count == 0)
+      continue;
+    ESP_LOGCONFIG(TAG, "    %s '%s': %" PRIu32 " calls, avg %" PRIu32 " us, max %" PRIu32 " us",
+                  item.component == nullptr ? "<none>" : item.component->get_component_source(), item.name.c_str(),
+                  item.stat.count, uint32_t(item.stat.total_us / item.stat.count), item.stat.max_us);
+  }
+}
+#endif
+
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
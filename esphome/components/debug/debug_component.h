@@ -11,6 +11,9 @@
 #ifdef USE_TEXT_SENSOR
 #include "esphome/components/text_sensor/text_sensor.h"
 #endif
+#ifdef USE_RUNTIME_STATS
+#include <map>
+#endif
 
 namespace esphome {
 namespace debug {
@@ -25,6 +28,11 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   void set_device_info_sensor(text_sensor::TextSensor *device_info) { device_info_ = device_info; }
   void set_reset_reason_sensor(text_sensor::TextSensor *reset_reason) { reset_reason_ = reset_reason; }
+#ifdef USE_RUNTIME_STATS
+  void set_busiest_component_sensor(text_sensor::TextSensor *busiest_component) {
+    busiest_component_ = busiest_component;
+  }
+#endif
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
@@ -40,6 +48,15 @@ class DebugComponent : public PollingComponent {
  protected:
   uint32_t free_heap_{};
 
+#ifdef USE_RUNTIME_STATS
+  /// Time each component spent in loop() and scheduler callbacks since boot, in microseconds.
+  std::map<Component *, uint64_t> get_component_runtimes_();
+  void log_runtime_stats_();
+
+  std::map<Component *, uint64_t> last_runtimes_{};
+  uint32_t last_runtimes_time_{0};
+#endif
+
 #ifdef USE_SENSOR
   uint32_t last_loop_timetag_{0};
   uint32_t max_loop_time_{0};
@@ -58,6 +75,9 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
   text_sensor::TextSensor *reset_reason_{nullptr};
+#ifdef USE_RUNTIME_STATS
+  text_sensor::TextSensor *busiest_component_{nullptr};
+#endif
 #endif  // USE_TEXT_SENSOR
 };
 
@@ -2,6 +2,7 @@
 
 #include <utility>
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -35,11 +36,7 @@ void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
     }
   }
 }
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
-}
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -52,9 +49,71 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+  int min_y, max_y;
+  if (!this->clamp_y_(y1, height, min_y, max_y))
+    return;
+  for (int i = min_y; i < max_y; i++)
+    this->fill_span(x1, i, width, color);
+}
+void HOT Display::fill_span(int x, int y, int width, Color color) {
+  int min_x, max_x, min_y, max_y;
+  if (!this->clamp_y_(y, 1, min_y, max_y) || !this->clamp_x_(x, width, min_x, max_x))
+    return;
+  for (int i = min_x; i < max_x; i++)
+    this->draw_pixel_at(i, y, color);
+}
+void HOT Display::blit_rect(int x, int y, int width, int height, const uint8_t *data, PixelFormat format,
+                            bool transparent) {
+  int min_x, max_x, min_y, max_y;
+  if (!this->clamp_x_(x, width, min_x, max_x) || !this->clamp_y_(y, height, min_y, max_y))
+    return;
+  const uint8_t bytes = pixel_format_bytes_(format);
+  for (int row = min_y; row < max_y; row++) {
+    const uint8_t *src = data + (size_t(row - y) * width + (min_x - x)) * bytes;
+    for (int col = min_x; col < max_x; col++, src += bytes) {
+      const Color color = read_pixel_(src, format, transparent);
+      if (color.w >= 0x80)
+        this->draw_pixel_at(col, row, color);
+    }
+  }
+}
+uint8_t Display::pixel_format_bytes_(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::GRAYSCALE:
+      return 1;
+    case PixelFormat::RGB565:
+      return 2;
+    case PixelFormat::RGB24:
+      return 3;
+    case PixelFormat::RGBA:
+    default:
+      return 4;
+  }
+}
+Color HOT Display::read_pixel_(const uint8_t *data, PixelFormat format, bool transparent) {
+  switch (format) {
+    case PixelFormat::GRAYSCALE: {
+      const uint8_t gray = progmem_read_byte(data);
+      return Color(gray, gray, gray, (gray == 1 && transparent) ? 0 : 0xFF);
+    }
+    case PixelFormat::RGB565: {
+      const uint16_t rgb565 = progmem_read_byte(data) << 8 | progmem_read_byte(data + 1);
+      const uint8_t r = (rgb565 & 0xF800) >> 11;
+      const uint8_t g = (rgb565 & 0x07E0) >> 5;
+      const uint8_t b = rgb565 & 0x001F;
+      // The darkest green is the transparent color of RGB565
+      return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2),
+                   (rgb565 == 0x0020 && transparent) ? 0 : 0xFF);
+    }
+    case PixelFormat::RGB24: {
+      Color color(progmem_read_byte(data), progmem_read_byte(data + 1), progmem_read_byte(data + 2));
+      color.w = (color.b == 1 && color.r == 0 && color.g == 0 && transparent) ? 0 : 0xFF;
+      return color;
+    }
+    case PixelFormat::RGBA:
+    default:
+      return Color(progmem_read_byte(data), progmem_read_byte(data + 1), progmem_read_byte(data + 2),
+                   progmem_read_byte(data + 3));
   }
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
@@ -350,8 +409,9 @@ bool Display::clamp_x_(int x, int w, int &min_x, int &max_x) {
     if (!rect.is_set())
       return false;
 
+    // Like Rect::inside(), which clip() uses for single pixels, the clipping rectangle includes x2()
     min_x = std::max(min_x, (int) rect.x);
-    max_x = std::min(max_x, (int) rect.x2());
+    max_x = std::min(max_x, rect.x2() + 1);
   }
 
   return min_x < max_x;
@@ -366,7 +426,7 @@ bool Display::clamp_y_(int y, int h, int &min_y, int &max_y) {
       return false;
 
     min_y = std::max(min_y, (int) rect.y);
-    max_y = std::min(max_y, (int) rect.y2());
+    max_y = std::min(max_y, rect.y2() + 1);
   }
 
   return min_y < max_y;
@@ -129,6 +129,14 @@ enum DisplayType {
   DISPLAY_TYPE_COLOR = 3,
 };
 
+/// Formats of the pixel data passed to Display::blit_rect(), the same as the color image types.
+enum class PixelFormat {
+  GRAYSCALE = 0,  ///< 1 byte per pixel, gray value 1 is the transparent color
+  RGB565 = 1,     ///< 2 bytes per pixel, big endian, 0x0020 is the transparent color
+  RGB24 = 2,      ///< 3 bytes per pixel, (0, 0, 1) is the transparent color
+  RGBA = 3,       ///< 4 bytes per pixel, pixels with an alpha below 0x80 are transparent
+};
+
 enum DisplayRotation {
   DISPLAY_ROTATION_0_DEGREES = 0,
   DISPLAY_ROTATION_90_DEGREES = 90,
@@ -185,6 +193,23 @@ class Display : public PollingComponent {
   /// Set a single pixel at the specified coordinates to the given color.
   virtual void draw_pixel_at(int x, int y, Color color) = 0;
 
+  /** Fill `width` pixels to the right of [x,y] (including it) with the given color.
+   *
+   * All filled shapes and text are drawn with this. The default implementation draws pixel by pixel, displays with a
+   * buffer override it to clip and rotate once per span.
+   */
+  virtual void fill_span(int x, int y, int width, Color color);
+
+  /** Draw a block of width x height pixels with the top-left corner at [x,y].
+   *
+   * @param data The pixels row by row in the given format, may be stored in flash.
+   * @param format The format of the pixels, which is converted to the format of the display.
+   * @param transparent Skip the pixels with the transparent color of the format. RGBA pixels are always skipped if
+   * their alpha is below 0x80.
+   */
+  virtual void blit_rect(int x, int y, int width, int height, const uint8_t *data, PixelFormat format,
+                         bool transparent);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -496,6 +521,11 @@ class Display : public PollingComponent {
   bool clip(int x, int y);
 
  protected:
+  /// Read one pixel in the given format, transparent pixels are returned with an alpha of 0.
+  static Color read_pixel_(const uint8_t *data, PixelFormat format, bool transparent);
+  static uint8_t pixel_format_bytes_(PixelFormat format);
+
+  /// Clamp the span [x, x + w) to the display and the clipping rectangle, max_x is exclusive.
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
   void vprintf_(int x, int y, BaseFont *font, Color color, TextAlign align, const char *format, va_list arg);
@@ -1,5 +1,7 @@
 #include "display_buffer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -9,6 +11,10 @@ namespace esphome {
 namespace display {
 
 static const char *const TAG = "display";
+/// Number of pixels blit_rect() converts at once.
+static const int BLIT_CHUNK = 32;
+/// Above this many windows, changed tiles are combined per row before merging windows.
+static const size_t MAX_MERGE_WINDOWS = 32;
 
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
@@ -68,5 +74,259 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+void DisplayBuffer::to_internal_(int &x, int &y, int &dx, int &dy) {
+  const int x_in = x;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      dx = 1;
+      dy = 0;
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      x = this->get_width_internal() - y - 1;
+      y = x_in;
+      dx = 0;
+      dy = 1;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      x = this->get_width_internal() - x - 1;
+      y = this->get_height_internal() - y - 1;
+      dx = -1;
+      dy = 0;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      x = y;
+      y = this->get_height_internal() - x_in - 1;
+      dx = 0;
+      dy = -1;
+      break;
+  }
+}
+
+void HOT DisplayBuffer::fill_span(int x, int y, int width, Color color) {
+  int min_x, max_x, min_y, max_y;
+  if (!this->clamp_y_(y, 1, min_y, max_y) || !this->clamp_x_(x, width, min_x, max_x))
+    return;
+  const int length = max_x - min_x;
+  int dx, dy;
+  x = min_x;
+  this->to_internal_(x, y, dx, dy);
+  // Use the top-left corner of the span in internal coordinates
+  if (dx < 0)
+    x -= length - 1;
+  if (dy < 0)
+    y -= length - 1;
+  if (dx != 0) {
+    this->fill_rect_internal_(x, y, length, 1, color);
+  } else {
+    this->fill_rect_internal_(x, y, 1, length, color);
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::blit_rect(int x, int y, int width, int height, const uint8_t *data, PixelFormat format,
+                                  bool transparent) {
+  int min_x, max_x, min_y, max_y;
+  if (!this->clamp_x_(x, width, min_x, max_x) || !this->clamp_y_(y, height, min_y, max_y))
+    return;
+  const uint8_t bytes = pixel_format_bytes_(format);
+  Color colors[BLIT_CHUNK];
+  for (int row = min_y; row < max_y; row++) {
+    const uint8_t *src = data + (size_t(row - y) * width + (min_x - x)) * bytes;
+    for (int chunk_x = min_x; chunk_x < max_x; chunk_x += BLIT_CHUNK) {
+      const int count = std::min(BLIT_CHUNK, max_x - chunk_x);
+      for (int i = 0; i < count; i++, src += bytes)
+        colors[i] = read_pixel_(src, format, transparent);
+      // Write the runs of opaque pixels
+      int start = 0;
+      while (start < count) {
+        if (colors[start].w < 0x80) {
+          start++;
+          continue;
+        }
+        int end = start + 1;
+        while (end < count && colors[end].w >= 0x80)
+          end++;
+        int internal_x = chunk_x + start, internal_y = row, dx, dy;
+        this->to_internal_(internal_x, internal_y, dx, dy);
+        this->write_pixels_internal_(internal_x, internal_y, dx, dy, colors + start, end - start);
+        start = end;
+      }
+    }
+  }
+  App.feed_wdt();
+}
+
+void DisplayBuffer::fill_rect_internal_(int x, int y, int width, int height, Color color) {
+  for (int row = y; row < y + height; row++) {
+    for (int col = x; col < x + width; col++)
+      this->draw_absolute_pixel_internal(col, row, color);
+  }
+}
+
+void DisplayBuffer::write_pixels_internal_(int x, int y, int dx, int dy, const Color *colors, int count) {
+  for (int i = 0; i < count; i++, x += dx, y += dy)
+    this->draw_absolute_pixel_internal(x, y, colors[i]);
+}
+
+void DisplayBuffer::init_dirty_tracking_(uint8_t bytes_per_pixel) {
+  this->bytes_per_pixel_ = bytes_per_pixel;
+  this->tiles_x_ = (this->get_width_internal() + DIRTY_TILE_SIZE - 1) >> DIRTY_TILE_SHIFT;
+  this->tiles_y_ = (this->get_height_internal() + DIRTY_TILE_SIZE - 1) >> DIRTY_TILE_SHIFT;
+  const size_t tiles = size_t(this->tiles_x_) * this->tiles_y_;
+  this->dirty_tiles_.assign((tiles + 7) / 8, 0);
+  if (this->flushed_buffer_ == nullptr) {
+    // Doubling the buffer in internal RAM would take too much memory from everything else
+    ExternalRAMAllocator<uint8_t> allocator(static_cast<ExternalRAMAllocator<uint8_t>::Flags>(
+        ExternalRAMAllocator<uint8_t>::REFUSE_INTERNAL | ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE));
+    this->flushed_buffer_ = allocator.allocate(size_t(this->get_width_internal()) * this->get_height_internal() *
+                                               bytes_per_pixel);
+    if (this->flushed_buffer_ == nullptr)
+      ESP_LOGD(TAG, "No external RAM for a copy of the buffer, all drawn areas are sent to the display");
+  }
+  // What's on the display is unknown, so send everything on the first flush
+  this->force_full_flush_ = true;
+}
+
+void DisplayBuffer::mark_dirty_(int x, int y, int width, int height) {
+  if (this->dirty_tiles_.empty() || width <= 0 || height <= 0)
+    return;
+  for (int tile_y = y >> DIRTY_TILE_SHIFT; tile_y <= (y + height - 1) >> DIRTY_TILE_SHIFT; tile_y++) {
+    for (int tile_x = x >> DIRTY_TILE_SHIFT; tile_x <= (x + width - 1) >> DIRTY_TILE_SHIFT; tile_x++) {
+      const uint32_t tile = tile_y * this->tiles_x_ + tile_x;
+      this->dirty_tiles_[tile >> 3] |= 1 << (tile & 7);
+    }
+  }
+}
+
+void DisplayBuffer::mark_all_dirty_() { std::fill(this->dirty_tiles_.begin(), this->dirty_tiles_.end(), 0xFF); }
+
+static inline bool is_tile_dirty(const std::vector<uint8_t> &tiles, uint32_t index) {
+  return tiles[index >> 3] & (1 << (index & 7));
+}
+
+/// Combine the dirty tiles into at most max_windows rectangles (in tiles), without covering much more than needed.
+static std::vector<Rect> dirty_windows(const std::vector<uint8_t> &tiles, uint16_t tiles_x, uint16_t tiles_y,
+                                       uint8_t max_windows) {
+  std::vector<Rect> windows;
+  // Collect the runs of dirty tiles in every row, and stack runs onto a window of the row above with the same columns.
+  // If that gives too many windows to merge, use one run from the first to the last dirty tile of every row.
+  for (bool row_spans : {false, true}) {
+    windows.clear();
+    for (uint16_t y = 0; y < tiles_y; y++) {
+      uint16_t x = 0;
+      while (x < tiles_x) {
+        if (!is_tile_dirty(tiles, y * tiles_x + x)) {
+          x++;
+          continue;
+        }
+        const uint16_t run_start = x;
+        uint16_t run_end = x;
+        for (; x < tiles_x; x++) {
+          if (is_tile_dirty(tiles, y * tiles_x + x)) {
+            run_end = x + 1;
+          } else if (!row_spans) {
+            break;
+          }
+        }
+        const Rect run(run_start, y, run_end - run_start, 1);
+        auto above = std::find_if(windows.begin(), windows.end(), [&run](const Rect &window) {
+          return window.y2() == run.y && window.x == run.x && window.w == run.w;
+        });
+        if (above != windows.end()) {
+          above->h++;
+        } else {
+          windows.push_back(run);
+        }
+      }
+    }
+    if (windows.size() <= MAX_MERGE_WINDOWS)
+      break;
+  }
+
+  // Merge the pair of windows that adds the smallest area, as long as that's free or there are too many windows.
+  while (windows.size() > 1) {
+    size_t best_a = 0, best_b = 1;
+    int32_t best_cost = INT32_MAX;
+    for (size_t a = 0; a < windows.size(); a++) {
+      for (size_t b = a + 1; b < windows.size(); b++) {
+        Rect merged = windows[a];
+        merged.extend(windows[b]);
+        const int32_t cost = int32_t(merged.w) * merged.h - int32_t(windows[a].w) * windows[a].h -
+                             int32_t(windows[b].w) * windows[b].h;
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_a = a;
+          best_b = b;
+        }
+      }
+    }
+    if (best_cost > 0 && windows.size() <= max_windows)
+      break;
+    windows[best_a].extend(windows[best_b]);
+    windows.erase(windows.begin() + best_b);
+  }
+  return windows;
+}
+
+size_t DisplayBuffer::flush_dirty_(uint8_t max_windows) {
+  if (this->dirty_tiles_.empty() || this->buffer_ == nullptr)
+    return 0;
+
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  if (this->force_full_flush_)
+    this->mark_all_dirty_();
+
+  // Drop the written tiles whose content is the same as at the last flush, and update the copy of the others
+  size_t changed = 0;
+  for (uint16_t tile_y = 0; tile_y < this->tiles_y_; tile_y++) {
+    for (uint16_t tile_x = 0; tile_x < this->tiles_x_; tile_x++) {
+      const uint32_t index = tile_y * this->tiles_x_ + tile_x;
+      if (!is_tile_dirty(this->dirty_tiles_, index))
+        continue;
+      if (this->flushed_buffer_ == nullptr) {
+        changed++;
+        continue;
+      }
+      const int x = tile_x << DIRTY_TILE_SHIFT;
+      const int y = tile_y << DIRTY_TILE_SHIFT;
+      const size_t row_bytes = std::min<int>(DIRTY_TILE_SIZE, width - x) * this->bytes_per_pixel_;
+      const int y_end = std::min<int>(y + DIRTY_TILE_SIZE, height);
+      bool same = true;
+      for (int row = y; row < y_end; row++) {
+        const size_t offset = (size_t(row) * width + x) * this->bytes_per_pixel_;
+        if (memcmp(this->buffer_ + offset, this->flushed_buffer_ + offset, row_bytes) != 0) {
+          memcpy(this->flushed_buffer_ + offset, this->buffer_ + offset, row_bytes);
+          same = false;
+        }
+      }
+      if (same && !this->force_full_flush_) {
+        this->dirty_tiles_[index >> 3] &= ~(1 << (index & 7));
+        continue;
+      }
+      changed++;
+    }
+  }
+  this->force_full_flush_ = false;
+
+  size_t bytes = 0;
+  size_t windows = 0;
+  if (changed != 0) {
+    for (auto &window : dirty_windows(this->dirty_tiles_, this->tiles_x_, this->tiles_y_, max_windows)) {
+      const int16_t x = window.x << DIRTY_TILE_SHIFT;
+      const int16_t y = window.y << DIRTY_TILE_SHIFT;
+      bytes += this->write_window_(Rect(x, y, std::min<int>(window.w << DIRTY_TILE_SHIFT, width - x),
+                                        std::min<int>(window.h << DIRTY_TILE_SHIFT, height - y)));
+      windows++;
+    }
+    std::fill(this->dirty_tiles_.begin(), this->dirty_tiles_.end(), 0);
+  }
+  this->last_flush_bytes_ = bytes;
+  ESP_LOGV(TAG, "Flushed %zu bytes in %zu windows, %zu of %zu tiles changed", bytes, windows, changed,
+           size_t(this->tiles_x_) * this->tiles_y_);
+  return bytes;
+}
+
 }  // namespace display
 }  // namespace esphome
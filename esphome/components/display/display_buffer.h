@@ -5,6 +5,7 @@
 
 #include "display.h"
 #include "display_color_utils.h"
+#include "rect.h"
 
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
@@ -22,15 +23,72 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  void fill_span(int x, int y, int width, Color color) override;
+  void blit_rect(int x, int y, int width, int height, const uint8_t *data, PixelFormat format,
+                 bool transparent) override;
+
   virtual int get_height_internal() = 0;
   virtual int get_width_internal() = 0;
 
+  /// Number of bytes sent to the display by the last flush, for drivers with dirty tracking.
+  size_t get_last_flush_bytes() const { return this->last_flush_bytes_; }
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /// Fill the rectangle at the given internal coordinates, which is already clipped to the display.
+  virtual void fill_rect_internal_(int x, int y, int width, int height, Color color);
+  /** Write count pixels starting at [x,y] in internal coordinates, moving by [dx,dy] after every pixel.
+   *
+   * All pixels are inside the display. Drivers override this and fill_rect_internal_() to write their buffer without
+   * a virtual call per pixel.
+   */
+  virtual void write_pixels_internal_(int x, int y, int dx, int dy, const Color *colors, int count);
+  /// Convert [x,y] to internal coordinates, [dx,dy] is set to the internal direction of the x axis.
+  void to_internal_(int &x, int &y, int &dx, int &dy);
+
   void init_internal_(uint32_t buffer_length);
 
+  /** Dirty tracking for drivers that can send part of their buffer to the display.
+   *
+   * The screen is split into tiles of DIRTY_TILE_SIZE pixels squared. Drawing marks tiles as written, and at flush time
+   * the written tiles are compared with a copy of the buffer from the last flush, so that redrawing the same content
+   * (e.g. clearing and redrawing the whole screen on every update) doesn't cause a transfer. The copy is only kept in
+   * external RAM; without it, all written tiles are sent. The changed tiles are merged into at most max_windows
+   * rectangles, which are passed to write_window_().
+   *
+   * The buffer must be row-major with bytes_per_pixel bytes per pixel. Call after init_internal_().
+   */
+  void init_dirty_tracking_(uint8_t bytes_per_pixel);
+  /// Mark the pixel at the given internal coordinates as written.
+  inline void mark_dirty_(int x, int y) ALWAYS_INLINE {
+    if (this->dirty_tiles_.empty())
+      return;
+    const uint32_t tile = (y >> DIRTY_TILE_SHIFT) * this->tiles_x_ + (x >> DIRTY_TILE_SHIFT);
+    this->dirty_tiles_[tile >> 3] |= 1 << (tile & 7);
+  }
+  /// Mark the rectangle at the given internal coordinates as written.
+  void mark_dirty_(int x, int y, int width, int height);
+  void mark_all_dirty_();
+  /// Send all changed areas to the display with write_window_(). Returns the number of bytes written.
+  size_t flush_dirty_(uint8_t max_windows = 4);
+  /// Send the given area (internal coordinates) of the buffer to the display, returns the number of bytes written.
+  virtual size_t write_window_(const Rect &window) { return 0; }
+
+  static const uint8_t DIRTY_TILE_SHIFT = 4;
+  static const uint8_t DIRTY_TILE_SIZE = 1 << DIRTY_TILE_SHIFT;
+
   uint8_t *buffer_{nullptr};
+
+  uint8_t bytes_per_pixel_{0};
+  uint16_t tiles_x_{0};
+  uint16_t tiles_y_{0};
+  /// Bitmap of the tiles written to since the last flush.
+  std::vector<uint8_t> dirty_tiles_;
+  /// Copy of the buffer at the last flush, nullptr if it couldn't be allocated in external RAM.
+  uint8_t *flushed_buffer_{nullptr};
+  bool force_full_flush_{false};
+  size_t last_flush_bytes_{0};
 };
 
 }  // namespace display
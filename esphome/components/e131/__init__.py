@@ -23,6 +23,7 @@ CHANNELS = {
 
 CONF_UNIVERSE = "universe"
 CONF_E131_ID = "e131_id"
+CONF_FRAME_SYNC = "frame_sync"
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -46,6 +47,7 @@ async def to_code(config):
         cv.GenerateID(CONF_E131_ID): cv.use_id(E131Component),
         cv.Required(CONF_UNIVERSE): cv.int_range(min=1, max=512),
         cv.Optional(CONF_CHANNELS, default="RGB"): cv.one_of(*CHANNELS, upper=True),
+        cv.Optional(CONF_FRAME_SYNC, default=False): cv.boolean,
     },
 )
 async def e131_light_effect_to_code(config, effect_id):
@@ -55,4 +57,5 @@ async def e131_light_effect_to_code(config, effect_id):
     cg.add(effect.set_first_universe(config[CONF_UNIVERSE]))
     cg.add(effect.set_channels(CHANNELS[config[CONF_CHANNELS]]))
     cg.add(effect.set_e131(parent))
+    cg.add(effect.set_frame_sync(config[CONF_FRAME_SYNC]))
     return effect
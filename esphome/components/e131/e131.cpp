@@ -7,6 +7,7 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int MAX_PACKETS_PER_LOOP = 32;
 
 E131Component::E131Component() {}
 
@@ -52,25 +53,25 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
   uint8_t buf[1460];
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
-  }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
-
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
-  }
-
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  // A frame of a multi-universe setup arrives as several packets at once, handle all of them in the same loop
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len <= 0)
+      return;
+
+    // packet.values points into buf, the effects copy the data straight into the LED buffers
+    if (!this->packet_(buf, len, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+
+    if (!this->process_(universe, packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    }
   }
 }
 
@@ -109,6 +110,16 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
 
   ESP_LOGV(TAG, "Received E1.31 packet for %d universe, with %d bytes", universe, packet.count);
 
+  // Only keep track of universes an effect listens to, anyone on the network can send packets for any universe
+  auto consumers = this->universe_consumers_.find(universe);
+  if (consumers == this->universe_consumers_.end() || consumers->second <= 0)
+    return false;
+
+  if (this->is_stale_(universe, packet.sequence)) {
+    ESP_LOGV(TAG, "Dropped out of order packet for %d universe (sequence %u).", universe, packet.sequence);
+    return true;
+  }
+
   for (auto *light_effect : light_effects_) {
     handled = light_effect->process_(universe, packet) || handled;
   }
@@ -116,5 +127,20 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
   return handled;
 }
 
+bool E131Component::is_stale_(int universe, uint8_t sequence) {
+  auto it = this->universe_sequences_.find(universe);
+  if (it == this->universe_sequences_.end()) {
+    this->universe_sequences_[universe] = sequence;
+    return false;
+  }
+  // E1.31 section 6.7.2: a packet up to 20 sequence numbers behind the last one is stale, anything further behind means
+  // the source restarted.
+  int8_t diff = int8_t(sequence - it->second);
+  if (diff <= 0 && diff > -20)
+    return true;
+  it->second = sequence;
+  return false;
+}
+
 }  // namespace e131
 }  // namespace esphome
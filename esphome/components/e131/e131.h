@@ -20,7 +20,9 @@ const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  uint8_t sequence;
+  /// Property values (start code followed by the DMX data), pointing into the receive buffer.
+  const uint8_t *values;
 };
 
 class E131Component : public esphome::Component {
@@ -38,8 +40,9 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
+  bool is_stale_(int universe, uint8_t sequence);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
@@ -48,7 +51,8 @@ class E131Component : public esphome::Component {
   std::unique_ptr<socket::Socket> socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  /// Sequence number of the last packet received for each universe in universe_consumers_.
+  std::map<int, uint8_t> universe_sequences_;
 };
 
 }  // namespace e131
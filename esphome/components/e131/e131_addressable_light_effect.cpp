@@ -6,7 +6,7 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = (E131_MAX_PROPERTY_VALUES_COUNT - 1);
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -27,6 +27,11 @@ int E131AddressableLightEffect::get_universe_count() const {
 void E131AddressableLightEffect::start() {
   AddressableLightEffect::start();
 
+  this->rgb_white_ =
+      this->get_addressable_()->get_traits().supports_color_capability(light::ColorCapability::WHITE);
+  this->received_universes_.assign(this->get_universe_count(), false);
+  this->received_count_ = 0;
+
   if (this->e131_) {
     this->e131_->add_effect(this);
   }
@@ -60,33 +65,43 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
   ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name().c_str(), universe,
            output_offset, output_end);
 
-  switch (channels_) {
-    case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
-      break;
-
-    case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
-      break;
-
-    case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
-      break;
+  if (this->channels_ == E131_RGB && this->rgb_white_) {
+    // Derive white from RGB, which the bulk copy can't do
+    for (; output_offset < output_end; output_offset++, input_data += 3) {
+      auto output = (*it)[output_offset];
+      output.set(
+          Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
+    }
+  } else {
+    it->range(output_offset, output_end).set_from_buffer(input_data, this->channels_);
   }
 
+  if (this->frame_sync_ && !this->frame_complete_(universe))
+    return true;
+
   it->schedule_show();
   return true;
 }
 
+bool E131AddressableLightEffect::frame_complete_(int universe) {
+  const size_t index = universe - this->first_universe_;
+  if (index >= this->received_universes_.size())
+    return true;
+  if (this->received_universes_[index]) {
+    // The universe repeated before the frame was complete, so part of the last frame got lost. Show what arrived and
+    // start collecting the next frame with this universe.
+    this->received_universes_.assign(this->received_universes_.size(), false);
+    this->received_universes_[index] = true;
+    this->received_count_ = 1;
+    return true;
+  }
+  this->received_universes_[index] = true;
+  if (++this->received_count_ < int(this->received_universes_.size()))
+    return false;
+  this->received_universes_.assign(this->received_universes_.size(), false);
+  this->received_count_ = 0;
+  return true;
+}
+
 }  // namespace e131
 }  // namespace esphome
@@ -3,6 +3,8 @@
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
 
+#include <vector>
+
 namespace esphome {
 namespace e131 {
 
@@ -28,14 +30,24 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
   void set_first_universe(int universe) { this->first_universe_ = universe; }
   void set_channels(E131LightChannels channels) { this->channels_ = channels; }
   void set_e131(E131Component *e131) { this->e131_ = e131; }
+  /// Only show the received data once all universes of a frame have arrived.
+  void set_frame_sync(bool frame_sync) { this->frame_sync_ = frame_sync; }
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  /// Record the universe for frame_sync, returns true when the frame should be shown.
+  bool frame_complete_(int universe);
 
   int first_universe_{0};
   int last_universe_{0};
   E131LightChannels channels_{E131_RGB};
   E131Component *e131_{nullptr};
+  bool frame_sync_{false};
+  /// Whether the light has a white channel, which RGB data sets to the average of red, green and blue.
+  bool rgb_white_{false};
+  /// Universes received for the current frame with frame_sync.
+  std::vector<bool> received_universes_;
+  int received_count_{0};
 
   friend class E131Component;
 };
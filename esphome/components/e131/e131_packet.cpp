@@ -100,6 +100,8 @@ void E131Component::leave_(int universe) {
     return;  // we have other consumers of the given universe
   }
 
+  this->universe_sequences_.erase(universe);
+
   if (listen_method_ == E131_MULTICAST) {
     ip4_addr_t multicast_addr = network::IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff));
 
@@ -109,11 +111,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -130,8 +132,12 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  // Don't trust the count beyond what was actually received
+  if (packet.count > len - (E131_MIN_PACKET_SIZE - 1))
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  packet.sequence = sbuff->sequence_number;
+  packet.values = sbuff->property_values;
   return true;
 }
 
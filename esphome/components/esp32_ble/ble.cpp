@@ -308,6 +308,9 @@ void ESP32BLE::loop() {
 void ESP32BLE::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
   BLEEvent *new_event = new BLEEvent(event, param);  // NOLINT(cppcoreguidelines-owning-memory)
   global_ble->ble_events_.push(new_event);
+#ifdef USE_TICKLESS_IDLE
+  App.wake_loop();
+#endif
 }  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
 
 void ESP32BLE::real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
@@ -321,6 +324,9 @@ void ESP32BLE::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gat
                                    esp_ble_gatts_cb_param_t *param) {
   BLEEvent *new_event = new BLEEvent(event, gatts_if, param);  // NOLINT(cppcoreguidelines-owning-memory)
   global_ble->ble_events_.push(new_event);
+#ifdef USE_TICKLESS_IDLE
+  App.wake_loop();
+#endif
 }  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
 
 void ESP32BLE::real_gatts_event_handler_(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
@@ -335,6 +341,9 @@ void ESP32BLE::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gat
                                    esp_ble_gattc_cb_param_t *param) {
   BLEEvent *new_event = new BLEEvent(event, gattc_if, param);  // NOLINT(cppcoreguidelines-owning-memory)
   global_ble->ble_events_.push(new_event);
+#ifdef USE_TICKLESS_IDLE
+  App.wake_loop();
+#endif
 }  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
 
 void ESP32BLE::real_gattc_event_handler_(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
@@ -81,6 +81,12 @@ class ESP32BLE : public Component {
   bool is_active();
   void setup() override;
   void loop() override;
+#ifdef USE_TICKLESS_IDLE
+  /// Events of the BT stack wake the loop, only enabling and disabling take more than one loop().
+  bool can_idle() override {
+    return this->state_ != BLE_COMPONENT_STATE_ENABLE && this->state_ != BLE_COMPONENT_STATE_DISABLE;
+  }
+#endif
   void dump_config() override;
   float get_setup_priority() const override;
 
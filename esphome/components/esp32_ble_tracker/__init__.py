@@ -19,7 +19,7 @@ from esphome.components import esp32_ble
 from esphome.core import CORE
 from esphome.components.esp32 import add_idf_sdkconfig_option
 
-AUTO_LOAD = ["esp32_ble"]
+AUTO_LOAD = ["esp32_ble", "ble_advertisement"]
 DEPENDENCIES = ["esp32"]
 
 CONF_ESP32_BLE_ID = "esp32_ble_id"
@@ -27,6 +27,8 @@ CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
 CONF_CONTINUOUS = "continuous"
 CONF_ON_SCAN_END = "on_scan_end"
+CONF_MAX_DEVICES = "max_devices"
+CONF_SKIP_UNCHANGED_ADVERTISEMENTS = "skip_unchanged_advertisements"
 esp32_ble_tracker_ns = cg.esphome_ns.namespace("esp32_ble_tracker")
 ESP32BLETracker = esp32_ble_tracker_ns.class_(
     "ESP32BLETracker",
@@ -164,6 +166,10 @@ CONFIG_SCHEMA = cv.Schema(
             ),
             validate_scan_parameters,
         ),
+        cv.Optional(CONF_MAX_DEVICES, default=64): cv.int_range(min=1, max=1024),
+        cv.Optional(
+            CONF_SKIP_UNCHANGED_ADVERTISEMENTS
+        ): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_ON_BLE_ADVERTISE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ESPBTAdvertiseTrigger),
@@ -221,6 +227,11 @@ async def to_code(config):
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
     cg.add(var.set_scan_continuous(params[CONF_CONTINUOUS]))
+    cg.add(var.set_max_devices(config[CONF_MAX_DEVICES]))
+    if CONF_SKIP_UNCHANGED_ADVERTISEMENTS in config:
+        cg.add(
+            var.set_skip_unchanged_interval(config[CONF_SKIP_UNCHANGED_ADVERTISEMENTS])
+        )
     for conf in config.get(CONF_ON_BLE_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         if CONF_MAC_ADDRESS in conf:
@@ -119,15 +119,37 @@ void ESP32BLETracker::loop() {
         }
       }
 
+      bool dispatch[ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE];
+      if (this->view_advertisements_ || this->parse_advertisements_) {
+        const uint32_t now = millis();
+        for (size_t i = 0; i < index; i++)
+          dispatch[i] = this->update_device_(this->scan_result_buffer_[i], now);
+      }
+
+      if (this->view_advertisements_) {
+        for (size_t i = 0; i < index; i++) {
+          if (!dispatch[i])
+            continue;
+          const ESPBTDeviceView device(this->scan_result_buffer_[i]);
+          for (auto *listener : this->listeners_)
+            listener->parse_device_view(device);
+        }
+      }
+
       if (this->parse_advertisements_) {
         for (size_t i = 0; i < index; i++) {
+          // Clients always get every advertisement, so that they don't wait for the device they connect to
+          if (!dispatch[i] && this->clients_.empty())
+            continue;
           ESPBTDevice device;
           device.parse_scan_rst(this->scan_result_buffer_[i]);
 
-          bool found = false;
-          for (auto *listener : this->listeners_) {
-            if (listener->parse_device(device))
-              found = true;
+          bool found = !dispatch[i];
+          if (dispatch[i]) {
+            for (auto *listener : this->listeners_) {
+              if (listener->parse_device(device))
+                found = true;
+            }
           }
 
           for (auto *client : this->clients_) {
@@ -268,7 +290,7 @@ void ESP32BLETracker::start_scan_(bool first) {
     for (auto *listener : this->listeners_)
       listener->on_scan_end();
   }
-  this->already_discovered_.clear();
+  this->scan_count_++;
   this->scan_params_.scan_type = this->scan_active_ ? BLE_SCAN_TYPE_ACTIVE : BLE_SCAN_TYPE_PASSIVE;
   this->scan_params_.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
   this->scan_params_.scan_filter_policy = BLE_SCAN_FILTER_ALLOW_ALL;
@@ -302,7 +324,6 @@ void ESP32BLETracker::end_of_scan_() {
 
   ESP_LOGD(TAG, "End of scan.");
   this->scanner_idle_ = true;
-  this->already_discovered_.clear();
   xSemaphoreGive(this->scan_end_lock_);
   this->cancel_timeout("scan");
 
@@ -325,11 +346,18 @@ void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
+  this->view_advertisements_ = false;
   for (auto *listener : this->listeners_) {
-    if (listener->get_advertisement_parser_type() == AdvertisementParserType::PARSED_ADVERTISEMENTS) {
-      this->parse_advertisements_ = true;
-    } else {
-      this->raw_advertisements_ = true;
+    switch (listener->get_advertisement_parser_type()) {
+      case AdvertisementParserType::PARSED_ADVERTISEMENTS:
+        this->parse_advertisements_ = true;
+        break;
+      case AdvertisementParserType::VIEW_ADVERTISEMENTS:
+        this->view_advertisements_ = true;
+        break;
+      default:
+        this->raw_advertisements_ = true;
+        break;
     }
   }
   for (auto *client : this->clients_) {
@@ -394,6 +422,31 @@ void ESP32BLETracker::gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_re
   }
 }
 
+bool ESP32BLETracker::update_device_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param, uint32_t now) {
+  bool inserted;
+  auto *device = this->devices_.insert(ble_addr_to_uint64(param.bda), now, &inserted);
+  const uint8_t length = param.adv_data_len + param.scan_rsp_len;
+  const uint32_t hash = ble_advertisement::DeviceTable::hash_payload(param.ble_adv, length);
+  // Active scans report the advertisement and the scan response separately, keep a hash and length of both
+  const bool scan_response = param.ble_evt_type == ESP_BLE_EVT_SCAN_RSP;
+  uint32_t &last_hash = scan_response ? device->scan_response_hash : device->payload_hash;
+  uint8_t &last_length = scan_response ? device->scan_response_length : device->payload_length;
+
+  bool dispatch = inserted || device->scan != this->scan_count_ || last_hash != hash || last_length != length ||
+                  now - device->last_dispatched >= this->skip_unchanged_interval_;
+  if (device->scan != this->scan_count_) {
+    device->scan = this->scan_count_;
+    device->printed = false;
+  }
+  last_hash = hash;
+  last_length = length;
+  device->rssi = param.rssi;
+  device->last_seen = now;
+  if (dispatch)
+    device->last_dispatched = now;
+  return dispatch;
+}
+
 void ESP32BLETracker::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
                                           esp_ble_gattc_cb_param_t *param) {
   for (auto *client : this->clients_) {
@@ -440,20 +493,20 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
             this->address_[2], this->address_[3], this->address_[4], this->address_[5], address_type);
 
   ESP_LOGVV(TAG, "  RSSI: %d", this->rssi_);
-  ESP_LOGVV(TAG, "  Name: '%s'", this->name_.c_str());
-  for (auto &it : this->tx_powers_) {
+  ESP_LOGVV(TAG, "  Name: '%s'", this->parsed_.name.c_str());
+  for (auto &it : this->parsed_.tx_powers) {
     ESP_LOGVV(TAG, "  TX Power: %d", it);
   }
-  if (this->appearance_.has_value()) {
-    ESP_LOGVV(TAG, "  Appearance: %u", *this->appearance_);
+  if (this->parsed_.appearance.has_value()) {
+    ESP_LOGVV(TAG, "  Appearance: %u", *this->parsed_.appearance);
   }
-  if (this->ad_flag_.has_value()) {
-    ESP_LOGVV(TAG, "  Ad Flag: %u", *this->ad_flag_);
+  if (this->parsed_.ad_flag.has_value()) {
+    ESP_LOGVV(TAG, "  Ad Flag: %u", *this->parsed_.ad_flag);
   }
-  for (auto &uuid : this->service_uuids_) {
+  for (auto &uuid : this->parsed_.service_uuids) {
     ESP_LOGVV(TAG, "  Service UUID: %s", uuid.to_string().c_str());
   }
-  for (auto &data : this->manufacturer_datas_) {
+  for (auto &data : this->parsed_.manufacturer_datas) {
     ESP_LOGVV(TAG, "  Manufacturer data: %s", format_hex_pretty(data.data).c_str());
     if (this->get_ibeacon().has_value()) {
       auto ibeacon = this->get_ibeacon().value();
@@ -464,7 +517,7 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
       ESP_LOGVV(TAG, "      TXPower: %d", ibeacon.get_signal_power());
     }
   }
-  for (auto &data : this->service_datas_) {
+  for (auto &data : this->parsed_.service_datas) {
     ESP_LOGVV(TAG, "  Service data:");
     ESP_LOGVV(TAG, "    UUID: %s", data.uuid.to_string().c_str());
     ESP_LOGVV(TAG, "    Data: %s", format_hex_pretty(data.data).c_str());
@@ -474,164 +527,7 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
 #endif
 }
 void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
-  size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
-
-    // See also Generic Access Profile Assigned Numbers:
-    // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
-    // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
-    // See also Core Specification Supplement: https://www.bluetooth.com/specifications/bluetooth-core-specification/
-    // (called CSS here)
-
-    switch (record_type) {
-      case ESP_BLE_AD_TYPE_NAME_SHORT:
-      case ESP_BLE_AD_TYPE_NAME_CMPL: {
-        // CSS 1.2 LOCAL NAME
-        // "The Local Name data type shall be the same as, or a shortened version of, the local name assigned to the
-        // device." CSS 1: Optional in this context; shall not appear more than once in a block.
-        // SHORTENED LOCAL NAME
-        // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
-        // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
-        if (record_length > this->name_.length()) {
-          this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
-        }
-        break;
-      }
-      case ESP_BLE_AD_TYPE_TX_PWR: {
-        // CSS 1.5 TX POWER LEVEL
-        // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
-        // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_APPEARANCE: {
-        // CSS 1.12 APPEARANCE
-        // "The Appearance data type defines the external appearance of the device."
-        // See also https://www.bluetooth.com/specifications/gatt/characteristics/
-        // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
-        // the AD and SRD of the same extended advertising interval.
-        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_FLAG: {
-        // CSS 1.3 FLAGS
-        // "The Flags data type contains one bit Boolean flags. The Flags data type shall be included when any of the
-        // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
-        // omitted."
-        // CSS 1: Optional in this context; shall not appear more than once in a block.
-        this->ad_flag_ = *record;
-        break;
-      }
-      // CSS 1.1 SERVICE UUID
-      // The Service UUID data type is used to include a list of Service or Service Class UUIDs.
-      // There are six data types defined for the three sizes of Service UUIDs that may be returned:
-      // CSS 1: Optional in this context (may appear more than once in a block).
-      case ESP_BLE_AD_TYPE_16SRV_CMPL:
-      case ESP_BLE_AD_TYPE_16SRV_PART: {
-        // • 16-bit Bluetooth Service UUIDs
-        for (uint8_t i = 0; i < record_length / 2; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
-        }
-        break;
-      }
-      case ESP_BLE_AD_TYPE_32SRV_CMPL:
-      case ESP_BLE_AD_TYPE_32SRV_PART: {
-        // • 32-bit Bluetooth Service UUIDs
-        for (uint8_t i = 0; i < record_length / 4; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
-        }
-        break;
-      }
-      case ESP_BLE_AD_TYPE_128SRV_CMPL:
-      case ESP_BLE_AD_TYPE_128SRV_PART: {
-        // • Global 128-bit Service UUIDs
-        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
-        break;
-      }
-      case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
-        // CSS 1.4 MANUFACTURER SPECIFIC DATA
-        // "The Manufacturer Specific data type is used for manufacturer specific data. The first two data octets shall
-        // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
-        // shall be defined by the manufacturer specified by the company identifier."
-        // CSS 1: Optional in this context (may appear more than once in a block).
-        if (record_length < 2) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
-        this->manufacturer_datas_.push_back(data);
-        break;
-      }
-
-      // CSS 1.11 SERVICE DATA
-      // "The Service Data data type consists of a service UUID with the data associated with that service."
-      // CSS 1: Optional in this context (may appear more than once in a block).
-      case ESP_BLE_AD_TYPE_SERVICE_DATA: {
-        // «Service Data - 16 bit UUID»
-        // Size: 2 or more octets
-        // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
-        if (record_length < 2) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_SERVICE_DATA");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
-        this->service_datas_.push_back(data);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_32SERVICE_DATA: {
-        // «Service Data - 32 bit UUID»
-        // Size: 4 or more octets
-        // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
-        if (record_length < 4) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_32SERVICE_DATA");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
-        data.data.assign(record + 4UL, record + record_length);
-        this->service_datas_.push_back(data);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
-        // «Service Data - 128 bit UUID»
-        // Size: 16 or more octets
-        // The first 16 octets contain the 128 bit Service UUID followed by additional service data
-        if (record_length < 16) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_128SERVICE_DATA");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_raw(record);
-        data.data.assign(record + 16UL, record + record_length);
-        this->service_datas_.push_back(data);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_INT_RANGE:
-        // Avoid logging this as it's very verbose
-        break;
-      default: {
-        ESP_LOGV(TAG, "Unhandled type: advType: 0x%02x", record_type);
-        break;
-      }
-    }
-  }
+  this->parsed_.parse(param.ble_adv, param.adv_data_len + param.scan_rsp_len);
 }
 std::string ESPBTDevice::address_str() const {
   char mac[24];
@@ -641,6 +537,17 @@ std::string ESPBTDevice::address_str() const {
 }
 uint64_t ESPBTDevice::address_uint64() const { return esp32_ble::ble_addr_to_uint64(this->address_); }
 
+ESPBTUUID ESPBTDeviceView::to_uuid(const ble_advertisement::DataView &uuid) {
+  switch (uuid.size) {
+    case 2:
+      return ESPBTUUID::from_uint16(uuid[0] | (uuid[1] << 8));
+    case 4:
+      return ESPBTUUID::from_uint32(uuid[0] | (uuid[1] << 8) | (uuid[2] << 16) | (uint32_t(uuid[3]) << 24));
+    default:
+      return ESPBTUUID::from_raw(uuid.data);
+  }
+}
+
 void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "BLE Tracker:");
   ESP_LOGCONFIG(TAG, "  Scan Duration: %" PRIu32 " s", this->scan_duration_);
@@ -648,15 +555,18 @@ void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "  Scan Window: %.1f ms", this->scan_window_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Type: %s", this->scan_active_ ? "ACTIVE" : "PASSIVE");
   ESP_LOGCONFIG(TAG, "  Continuous Scanning: %s", this->scan_continuous_ ? "True" : "False");
+  ESP_LOGCONFIG(TAG, "  Max Devices: %u", this->devices_.get_max_devices());
+  if (this->skip_unchanged_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Skip Unchanged Advertisements: %" PRIu32 " ms", this->skip_unchanged_interval_);
 }
 
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
-  const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
-  }
-  this->already_discovered_.push_back(address);
+  bool inserted;
+  auto *entry = this->devices_.insert(device.address_uint64(), millis(), &inserted);
+  if (!inserted && entry->scan == this->scan_count_ && entry->printed)
+    return;
+  entry->scan = this->scan_count_;
+  entry->printed = true;
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
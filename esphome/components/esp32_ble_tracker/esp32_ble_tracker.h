@@ -17,6 +17,8 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
+#include "esphome/components/ble_advertisement/ble_advertisement.h"
+#include "esphome/components/ble_advertisement/device_table.h"
 #include "esphome/components/esp32_ble/ble.h"
 #include "esphome/components/esp32_ble/ble_uuid.h"
 
@@ -30,6 +32,8 @@ using adv_data_t = std::vector<uint8_t>;
 enum AdvertisementParserType {
   PARSED_ADVERTISEMENTS,
   RAW_ADVERTISEMENTS,
+  /// parse_device_view() with a view into the scan result, which doesn't allocate anything.
+  VIEW_ADVERTISEMENTS,
 };
 
 struct ServiceData {
@@ -71,22 +75,22 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
+  const std::string &get_name() const { return this->parsed_.name; }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  const std::vector<int8_t> &get_tx_powers() const { return this->parsed_.tx_powers; }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const optional<uint16_t> &get_appearance() const { return this->parsed_.appearance; }
+  const optional<uint8_t> &get_ad_flag() const { return this->parsed_.ad_flag; }
+  const std::vector<ESPBTUUID> &get_service_uuids() const { return this->parsed_.service_uuids; }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  const std::vector<ServiceData> &get_manufacturer_datas() const { return this->parsed_.manufacturer_datas; }
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  const std::vector<ServiceData> &get_service_datas() const { return this->parsed_.service_datas; }
 
   const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &get_scan_result() const { return scan_result_; }
 
   optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
+    for (auto &it : this->parsed_.manufacturer_datas) {
       auto res = ESPBLEiBeacon::from_manufacturer_data(it);
       if (res.has_value())
         return *res;
@@ -102,22 +106,40 @@ class ESPBTDevice {
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_{};
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
+  ble_advertisement::ParsedAdvertisement<ESPBTUUID, ServiceData> parsed_{};
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_{};
 };
 
+/** A scan result for listeners that opt into VIEW_ADVERTISEMENTS.
+ *
+ * Unlike ESPBTDevice nothing is copied into vectors and strings: names, UUIDs, service data and manufacturer data are
+ * returned as views into the scan result, which are only valid during the call to parse_device_view().
+ */
+class ESPBTDeviceView : public ble_advertisement::AdvertisementView {
+ public:
+  explicit ESPBTDeviceView(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param)
+      : AdvertisementView(param.bda, param.ble_addr_type, param.rssi, param.ble_adv,
+                          param.adv_data_len + param.scan_rsp_len),
+        scan_result_(param) {}
+
+  esp_ble_addr_type_t get_address_type() const { return this->scan_result_.ble_addr_type; }
+  const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &get_scan_result() const { return this->scan_result_; }
+
+  /// Convert a 2, 4 or 16 byte UUID of the advertisement to an ESPBTUUID.
+  static ESPBTUUID to_uuid(const ble_advertisement::DataView &uuid);
+
+ protected:
+  const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &scan_result_;
+};
+
 class ESP32BLETracker;
 
 class ESPBTDeviceListener {
  public:
   virtual void on_scan_end() {}
-  virtual bool parse_device(const ESPBTDevice &device) = 0;
+  virtual bool parse_device(const ESPBTDevice &device) { return false; }
+  /// Called for every scan result if get_advertisement_parser_type() is VIEW_ADVERTISEMENTS.
+  virtual bool parse_device_view(const ESPBTDeviceView &device) { return false; }
   virtual bool parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_param *advertisements, size_t count) {
     return false;
   };
@@ -188,6 +210,15 @@ class ESP32BLETracker : public Component,
   void set_scan_window(uint32_t scan_window) { scan_window_ = scan_window; }
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+  void set_max_devices(uint16_t max_devices) { this->devices_ = ble_advertisement::DeviceTable(max_devices); }
+  /** Pass advertisements that didn't change to parse_device() at most once per interval, and once every scan.
+   *
+   * Changes are detected by the length and a 32-bit hash of the payload, so a changed payload of the same length is
+   * treated as unchanged in about one of 4 billion cases, until the interval ends.
+   */
+  void set_skip_unchanged_interval(uint32_t skip_unchanged_interval) {
+    this->skip_unchanged_interval_ = skip_unchanged_interval;
+  }
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -218,6 +249,8 @@ class ESP32BLETracker : public Component,
   void end_of_scan_();
   /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received.
   void gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Update the device table with a scan result, returns whether it should be passed on to the listeners.
+  bool update_device_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param, uint32_t now);
   /// Called when a `ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT` event is received.
   void gap_scan_set_param_complete_(const esp_ble_gap_cb_param_t::ble_scan_param_cmpl_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_START_COMPLETE_EVT` event is received.
@@ -227,8 +260,11 @@ class ESP32BLETracker : public Component,
 
   int app_id_;
 
-  /// Vector of addresses that have already been printed in print_bt_device_info
-  std::vector<uint64_t> already_discovered_;
+  /// The last advertisement of every device, also used to print every device once per scan in print_bt_device_info
+  ble_advertisement::DeviceTable devices_{64};
+  /// Incremented for every scan, to tell which devices have been seen in the current one.
+  uint8_t scan_count_{0};
+  uint32_t skip_unchanged_interval_{0};
   std::vector<ESPBTDeviceListener *> listeners_;
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
@@ -245,6 +281,7 @@ class ESP32BLETracker : public Component,
   bool ble_was_disabled_{true};
   bool raw_advertisements_{false};
   bool parse_advertisements_{false};
+  bool view_advertisements_{false};
   SemaphoreHandle_t scan_result_lock_;
   SemaphoreHandle_t scan_end_lock_;
   size_t scan_result_index_{0};
@@ -228,6 +228,13 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  light::ESPPixelBuffer get_pixel_buffer_internal() const override {
+    light::ESPPixelBuffer buffer;
+    buffer.pixels = reinterpret_cast<uint8_t *>(this->leds_);
+    buffer.effect_data = this->effect_data_;
+    buffer.stride = sizeof(CRGB);
+    return buffer;
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
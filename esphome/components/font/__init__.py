@@ -34,6 +34,14 @@ font_ns = cg.esphome_ns.namespace("font")
 Font = font_ns.class_("Font")
 Glyph = font_ns.class_("Glyph")
 GlyphData = font_ns.struct("GlyphData")
+GlyphEncoding = font_ns.enum("GlyphEncoding")
+
+ENCODING_BITMAP = "bitmap"
+ENCODING_RUN_LENGTH = "run_length"
+GLYPH_ENCODINGS = {
+    ENCODING_BITMAP: GlyphEncoding.GLYPH_ENCODING_BITMAP,
+    ENCODING_RUN_LENGTH: GlyphEncoding.GLYPH_ENCODING_RUN_LENGTH,
+}
 
 
 def validate_glyphs(value):
@@ -238,6 +246,8 @@ DEFAULT_GLYPHS = (
     ' !"%()+=,-.:/0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz°'
 )
 CONF_RAW_GLYPH_ID = "raw_glyph_id"
+CONF_ENCODING = "encoding"
+CONF_CACHE_SIZE = "cache_size"
 
 FONT_SCHEMA = cv.Schema(
     {
@@ -245,6 +255,10 @@ FONT_SCHEMA = cv.Schema(
         cv.Required(CONF_FILE): FILE_SCHEMA,
         cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
         cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
+        cv.Optional(CONF_ENCODING, default=ENCODING_BITMAP): cv.enum(
+            GLYPH_ENCODINGS, lower=True
+        ),
+        cv.Optional(CONF_CACHE_SIZE, default=0): cv.int_range(min=0, max=255),
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         cv.GenerateID(CONF_RAW_GLYPH_ID): cv.declare_id(GlyphData),
     }
@@ -347,6 +361,40 @@ def load_ttf_font(path, size):
     return TrueTypeFontWrapper(font)
 
 
+def encode_runs(mask, width, height):
+    """Encode every row as the number of runs and a (skip, length) pair per run."""
+    data = []
+    for y in range(height):
+        runs = []
+        x = 0
+        skip = 0
+        while x < width:
+            if not mask.getpixel((x, y)):
+                skip += 1
+                x += 1
+                continue
+            length = 0
+            while x < width and mask.getpixel((x, y)):
+                length += 1
+                x += 1
+            # Split what doesn't fit in a byte into empty and adjacent runs
+            while skip > 255:
+                runs += [255, 0]
+                skip -= 255
+            while length > 255:
+                runs += [skip, 255]
+                skip = 0
+                length -= 255
+            runs += [skip, length]
+            skip = 0
+        if len(runs) // 2 > 255:
+            raise core.EsphomeError(
+                f"Glyph has too many runs for run-length encoding: {len(runs) // 2}"
+            )
+        data += [len(runs) // 2] + runs
+    return data
+
+
 async def to_code(config):
     conf = config[CONF_FILE]
     if conf[CONF_TYPE] == TYPE_LOCAL_BITMAP:
@@ -368,14 +416,17 @@ async def to_code(config):
         mask = font.getmask(glyph, mode="1")
         offset_x, offset_y = font.getoffset(glyph)
         width, height = mask.size
-        width8 = ((width + 7) // 8) * 8
-        glyph_data = [0] * (height * width8 // 8)
-        for y in range(height):
-            for x in range(width):
-                if not mask.getpixel((x, y)):
-                    continue
-                pos = x + y * width8
-                glyph_data[pos // 8] |= 0x80 >> (pos % 8)
+        if config[CONF_ENCODING] == ENCODING_RUN_LENGTH:
+            glyph_data = encode_runs(mask, width, height)
+        else:
+            width8 = ((width + 7) // 8) * 8
+            glyph_data = [0] * (height * width8 // 8)
+            for y in range(height):
+                for x in range(width):
+                    if not mask.getpixel((x, y)):
+                        continue
+                    pos = x + y * width8
+                    glyph_data[pos // 8] |= 0x80 >> (pos % 8)
         glyph_args[glyph] = (len(data), offset_x, offset_y, width, height)
         data += glyph_data
 
@@ -401,6 +452,13 @@ async def to_code(config):
 
     glyphs = cg.static_const_array(config[CONF_RAW_GLYPH_ID], glyph_initializer)
 
-    cg.new_Pvariable(
-        config[CONF_ID], glyphs, len(glyph_initializer), ascent, ascent + descent
+    var = cg.new_Pvariable(
+        config[CONF_ID],
+        glyphs,
+        len(glyph_initializer),
+        ascent,
+        ascent + descent,
+        config[CONF_ENCODING],
     )
+    if config[CONF_CACHE_SIZE] > 0:
+        cg.add(var.set_cache_size(config[CONF_CACHE_SIZE]))
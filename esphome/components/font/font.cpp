@@ -1,5 +1,7 @@
 #include "font.h"
 
+#include <cstring>
+
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/color.h"
@@ -10,27 +12,59 @@ namespace font {
 
 static const char *const TAG = "font";
 
-void Glyph::draw(int x_at, int y_start, display::Display *display, Color color) const {
+/// Strings longer than this aren't cached.
+static const size_t MAX_CACHED_TEXT_LENGTH = 64;
+/// Strings with more spans than this aren't cached, so that the cache can't take much memory.
+static const size_t MAX_CACHED_SPANS = 512;
+
+template<typename F> void Glyph::for_each_span_(int x, int y, F &&callback) const {
   int scan_x1, scan_y1, scan_width, scan_height;
   this->scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
   const unsigned char *data = this->glyph_data_->data;
-  const int max_x = x_at + scan_x1 + scan_width;
-  const int max_y = y_start + scan_y1 + scan_height;
+  const int min_x = x + scan_x1;
+  const int max_x = min_x + scan_width;
+  const int max_y = y + scan_y1 + scan_height;
+
+  if (this->encoding_ == GLYPH_ENCODING_RUN_LENGTH) {
+    for (int glyph_y = y + scan_y1; glyph_y < max_y; glyph_y++) {
+      uint8_t runs = progmem_read_byte(data++);
+      int run_x = min_x;
+      for (; runs != 0; runs--, data += 2) {
+        run_x += progmem_read_byte(data);
+        const uint8_t length = progmem_read_byte(data + 1);
+        if (length != 0)
+          callback(run_x, glyph_y, length);
+        run_x += length;
+      }
+    }
+    return;
+  }
 
-  for (int glyph_y = y_start + scan_y1; glyph_y < max_y; glyph_y++) {
-    for (int glyph_x = x_at + scan_x1; glyph_x < max_x; data++, glyph_x += 8) {
+  for (int glyph_y = y + scan_y1; glyph_y < max_y; glyph_y++) {
+    int run_start = -1;
+    for (int glyph_x = min_x; glyph_x < max_x; data++, glyph_x += 8) {
       uint8_t pixel_data = progmem_read_byte(data);
       const int pixel_max_x = std::min(max_x, glyph_x + 8);
 
-      for (int pixel_x = glyph_x; pixel_x < pixel_max_x && pixel_data; pixel_x++, pixel_data <<= 1) {
+      for (int pixel_x = glyph_x; pixel_x < pixel_max_x; pixel_x++, pixel_data <<= 1) {
         if (pixel_data & 0x80) {
-          display->draw_pixel_at(pixel_x, glyph_y, color);
+          if (run_start < 0)
+            run_start = pixel_x;
+        } else if (run_start >= 0) {
+          callback(run_start, glyph_y, pixel_x - run_start);
+          run_start = -1;
         }
       }
     }
+    if (run_start >= 0)
+      callback(run_start, glyph_y, max_x - run_start);
   }
 }
+void Glyph::draw(int x_at, int y_start, display::Display *display, Color color) const {
+  this->for_each_span_(x_at, y_start,
+                       [display, color](int x, int y, int length) { display->fill_span(x, y, length, color); });
+}
 const char *Glyph::get_char() const { return this->glyph_data_->a_char; }
 bool Glyph::compare_to(const char *str) const {
   // 1 -> this->char_
@@ -65,10 +99,11 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
   *height = this->glyph_data_->height;
 }
 
-Font::Font(const GlyphData *data, int data_nr, int baseline, int height) : baseline_(baseline), height_(height) {
+Font::Font(const GlyphData *data, int data_nr, int baseline, int height, GlyphEncoding encoding)
+    : baseline_(baseline), height_(height) {
   glyphs_.reserve(data_nr);
   for (int i = 0; i < data_nr; ++i)
-    glyphs_.emplace_back(&data[i]);
+    glyphs_.emplace_back(&data[i], encoding);
 }
 int Font::match_next_glyph(const char *str, int *match_length) {
   int lo = 0;
@@ -89,6 +124,15 @@ int Font::match_next_glyph(const char *str, int *match_length) {
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
   *baseline = this->baseline_;
   *height = this->height_;
+  CachedText *cached = this->get_cached_(str);
+  if (cached != nullptr) {
+    *width = cached->width;
+    *x_offset = cached->x_offset;
+    return;
+  }
+  this->measure_(str, width, x_offset);
+}
+void Font::measure_(const char *str, int *width, int *x_offset) {
   int i = 0;
   int min_x = 0;
   bool has_char = false;
@@ -118,9 +162,9 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   *x_offset = min_x;
   *width = x - min_x;
 }
-void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text) {
+template<typename F> void Font::for_each_span_(const char *text, F &&callback) {
   int i = 0;
-  int x_at = x_start;
+  int x_at = 0;
   while (text[i] != '\0') {
     int match_length;
     int glyph_n = this->match_next_glyph(text + i, &match_length);
@@ -129,7 +173,8 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
       ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
       if (!this->get_glyphs().empty()) {
         uint8_t glyph_width = this->get_glyphs()[0].glyph_data_->width;
-        display->filled_rectangle(x_at, y_start, glyph_width, this->height_, color);
+        for (int y = 0; y < this->height_; y++)
+          callback(x_at, y, glyph_width);
         x_at += glyph_width;
       }
 
@@ -138,12 +183,75 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     }
 
     const Glyph &glyph = this->get_glyphs()[glyph_n];
-    glyph.draw(x_at, y_start, display, color);
+    glyph.for_each_span_(x_at, 0, callback);
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
     i += match_length;
   }
 }
+void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text) {
+  CachedText *cached = this->get_cached_(text);
+  if (cached != nullptr && cached->rendered) {
+    for (const auto &span : cached->spans)
+      display->fill_span(x_start + span.x, y_start + span.y, span.length, color);
+    return;
+  }
+
+  // Draw the glyphs, and keep their spans if the text is cached
+  bool record = cached != nullptr && !cached->too_large;
+  this->for_each_span_(text, [&](int x, int y, int length) {
+    display->fill_span(x_start + x, y_start + y, length, color);
+    if (!record)
+      return;
+    if (cached->spans.size() == MAX_CACHED_SPANS) {
+      record = false;
+      return;
+    }
+    cached->spans.push_back(TextSpan{int16_t(x), int16_t(y), uint16_t(length)});
+  });
+  if (cached == nullptr || cached->too_large)
+    return;
+  if (record) {
+    cached->rendered = true;
+  } else {
+    // Too large to keep, draw it from the glyphs every time
+    cached->too_large = true;
+    cached->spans.clear();
+    cached->spans.shrink_to_fit();
+  }
+}
+Font::CachedText *Font::get_cached_(const char *text) {
+  if (this->cache_size_ == 0)
+    return nullptr;
+  const size_t length = strlen(text);
+  if (length > MAX_CACHED_TEXT_LENGTH)
+    return nullptr;
+
+  this->cache_counter_++;
+  CachedText *oldest = nullptr;
+  for (auto &cached : this->cache_) {
+    if (cached.text.size() == length && memcmp(cached.text.data(), text, length) == 0) {
+      cached.last_used = this->cache_counter_;
+      return &cached;
+    }
+    if (oldest == nullptr || cached.last_used < oldest->last_used)
+      oldest = &cached;
+  }
+
+  // Replace the least recently used string
+  if (this->cache_.size() < this->cache_size_) {
+    this->cache_.reserve(this->cache_size_);
+    this->cache_.emplace_back();
+    oldest = &this->cache_.back();
+  }
+  oldest->text.assign(text, length);
+  oldest->rendered = false;
+  oldest->too_large = false;
+  oldest->spans.clear();
+  oldest->last_used = this->cache_counter_;
+  this->measure_(text, &oldest->width, &oldest->x_offset);
+  return oldest;
+}
 
 }  // namespace font
 }  // namespace esphome
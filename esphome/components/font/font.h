@@ -4,6 +4,9 @@
 #include "esphome/core/color.h"
 #include "esphome/components/display/display_buffer.h"
 
+#include <string>
+#include <vector>
+
 namespace esphome {
 namespace font {
 
@@ -18,9 +21,28 @@ struct GlyphData {
   int height;
 };
 
+/** How the pixels of the glyphs are stored.
+ *
+ * Bitmap glyphs store every row as bytes of 8 pixels. Run-length encoded glyphs store every row as a byte with the
+ * number of runs, followed by a (skip, length) byte pair for every run of set pixels, where skip is the number of
+ * clear pixels since the end of the previous run.
+ */
+enum GlyphEncoding : uint8_t {
+  GLYPH_ENCODING_BITMAP = 0,
+  GLYPH_ENCODING_RUN_LENGTH = 1,
+};
+
+/// A horizontal run of set pixels of a string, relative to the position it is printed at.
+struct TextSpan {
+  int16_t x;
+  int16_t y;
+  uint16_t length;
+};
+
 class Glyph {
  public:
-  Glyph(const GlyphData *data) : glyph_data_(data) {}
+  Glyph(const GlyphData *data, GlyphEncoding encoding = GLYPH_ENCODING_BITMAP)
+      : glyph_data_(data), encoding_(encoding) {}
 
   void draw(int x, int y, display::Display *display, Color color) const;
 
@@ -35,7 +57,11 @@ class Glyph {
  protected:
   friend Font;
 
+  /// Call callback(x, y, length) for every run of set pixels of the glyph drawn at [x,y].
+  template<typename F> void for_each_span_(int x, int y, F &&callback) const;
+
   const GlyphData *glyph_data_;
+  GlyphEncoding encoding_;
 };
 
 class Font : public display::BaseFont {
@@ -46,7 +72,8 @@ class Font : public display::BaseFont {
    * @param baseline The y-offset from the top of the text to the baseline.
    * @param bottom The y-offset from the top of the text to the bottom (i.e. height).
    */
-  Font(const GlyphData *data, int data_nr, int baseline, int height);
+  Font(const GlyphData *data, int data_nr, int baseline, int height,
+       GlyphEncoding encoding = GLYPH_ENCODING_BITMAP);
 
   int match_next_glyph(const char *str, int *match_length);
 
@@ -55,12 +82,35 @@ class Font : public display::BaseFont {
   inline int get_baseline() { return this->baseline_; }
   inline int get_height() { return this->height_; }
 
+  /// Keep the size and the rendered spans of the last cache_size strings, for pages that draw the same text often.
+  void set_cache_size(uint8_t cache_size) { this->cache_size_ = cache_size; }
+
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+  struct CachedText {
+    std::string text;
+    int width;
+    int x_offset;
+    bool rendered{false};
+    bool too_large{false};
+    uint32_t last_used;
+    std::vector<TextSpan> spans;
+  };
+
+  /// Call callback(x, y, length) for every run of set pixels of the text printed at [0,0].
+  template<typename F> void for_each_span_(const char *text, F &&callback);
+  void measure_(const char *str, int *width, int *x_offset);
+  /// Find the text in the cache or add it, returns nullptr if it can't be cached.
+  CachedText *get_cached_(const char *text);
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
   int baseline_;
   int height_;
+
+  uint8_t cache_size_{0};
+  uint32_t cache_counter_{0};
+  std::vector<CachedText> cache_;
 };
 
 }  // namespace font
@@ -1,3 +1,5 @@
+import os
+
 from esphome.const import (
     KEY_CORE,
     KEY_FRAMEWORK_VERSION,
@@ -18,6 +20,8 @@ from .gpio import host_pin_to_code  # noqa
 CODEOWNERS = ["@esphome/core"]
 AUTO_LOAD = ["network"]
 
+CONF_PREFERENCES_FILE = "preferences_file"
+
 
 def set_core_data(config):
     CORE.data[KEY_HOST] = {}
@@ -28,7 +32,11 @@ def set_core_data(config):
 
 
 CONFIG_SCHEMA = cv.All(
-    cv.Schema({}),
+    cv.Schema(
+        {
+            cv.Optional(CONF_PREFERENCES_FILE): cv.string_strict,
+        }
+    ),
     set_core_data,
 )
 
@@ -37,3 +45,9 @@ async def to_code(config):
     cg.add_build_flag("-DUSE_HOST")
     cg.add_define("ESPHOME_BOARD", "host")
     cg.add_platformio_option("platform", "platformio/native")
+
+    if CONF_PREFERENCES_FILE in config:
+        preferences_file = CORE.relative_config_path(config[CONF_PREFERENCES_FILE])
+    else:
+        preferences_file = CORE.relative_internal_path(f"{CORE.name}.prefs")
+    cg.add_define("ESPHOME_HOST_PREFERENCES_FILE", os.path.abspath(preferences_file))
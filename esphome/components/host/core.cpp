@@ -1,13 +1,31 @@
 #ifdef USE_HOST
 
+#include "core.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "preferences.h"
 
 #include <sched.h>
 #include <time.h>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
+#include <new>
+
+#ifdef USE_HOST_HEAP_COUNTER
+// Count the heap allocations of the whole program, only enabled by the benchmark components.
+static std::atomic<uint32_t> global_allocations{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void *operator new(size_t size) {
+  global_allocations++;
+  void *ptr = malloc(size ? size : 1);  // NOLINT(cppcoreguidelines-no-malloc)
+  if (ptr == nullptr)
+    abort();
+  return ptr;
+}
+void operator delete(void *ptr) noexcept { free(ptr); }               // NOLINT(cppcoreguidelines-no-malloc)
+void operator delete(void *ptr, size_t size) noexcept { free(ptr); }  // NOLINT(cppcoreguidelines-no-malloc)
+#endif
 
 namespace esphome {
 
@@ -62,6 +80,12 @@ uint32_t arch_get_cpu_cycle_count() {
 }
 uint32_t arch_get_cpu_freq_hz() { return 1000000000U; }
 
+#ifdef USE_HOST_HEAP_COUNTER
+namespace host {
+uint32_t get_heap_allocations() { return global_allocations; }
+}  // namespace host
+#endif
+
 }  // namespace esphome
 
 void setup();
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <cstdint>
+
+namespace esphome {
+namespace host {
+
+#ifdef USE_HOST_HEAP_COUNTER
+/// Number of heap allocations with operator new since startup, operator new is only replaced with this define.
+uint32_t get_heap_allocations();
+#endif
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
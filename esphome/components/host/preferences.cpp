@@ -1,29 +1,313 @@
 #ifdef USE_HOST
 
 #include "preferences.h"
+#include <cinttypes>
 #include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "esphome/core/preferences.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/core/defines.h"
 
+#ifndef ESPHOME_HOST_PREFERENCES_FILE
+#define ESPHOME_HOST_PREFERENCES_FILE "esphome.prefs"
+#endif
+
 namespace esphome {
 namespace host {
 
 static const char *const TAG = "host.preferences";
 
+/* The preferences are stored as an append-only log, like a flash page that is only ever written forward:
+ *
+ *   file header:  uint32 magic, uint32 version
+ *   record:       uint32 key, uint32 length, <length> bytes data, uint32 crc32 over key, length and data
+ *
+ * The last record of a key wins. sync() appends all changed preferences in one write followed by one fsync. A torn or
+ * corrupt tail (power loss during a write) is detected with the CRC and cut off on startup. Once the log holds mostly
+ * superseded records it is compacted by writing the live records to a new file that atomically replaces the old one.
+ */
+static const uint32_t PREFS_MAGIC = 0x46525045;  // "EPRF"
+static const uint32_t PREFS_VERSION = 1;
+static const size_t FILE_HEADER_SIZE = 8;
+static const size_t RECORD_OVERHEAD = 12;
+/// Compact once the log is this many times larger than its live records...
+static const size_t COMPACT_RATIO = 4;
+/// ...and larger than this, so a few small preferences don't get compacted all the time.
+static const size_t COMPACT_MIN_SIZE = 16384;
+
+static uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static void append_u32(std::vector<uint8_t> &out, uint32_t value) {
+  for (uint8_t i = 0; i < 4; i++)
+    out.push_back(value >> (i * 8));
+}
+
+static uint32_t read_u32(const uint8_t *data) {
+  return uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+}
+
+static void append_record(std::vector<uint8_t> &out, uint32_t key, const std::vector<uint8_t> &data) {
+  const size_t start = out.size();
+  append_u32(out, key);
+  append_u32(out, data.size());
+  out.insert(out.end(), data.begin(), data.end());
+  append_u32(out, crc32(&out[start], out.size() - start));
+}
+
+/// Write all of len, retrying on partial writes and EINTR.
+static bool write_all(int fd, const uint8_t *data, size_t len) {
+  while (len > 0) {
+    ssize_t written = ::write(fd, data, len);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += written;
+    len -= written;
+  }
+  return true;
+}
+
+class HostPreferences;
+
+class HostPreferenceBackend : public ESPPreferenceBackend {
+ public:
+  HostPreferenceBackend(HostPreferences *prefs, uint32_t key) : prefs_(prefs), key_(key) {}
+  bool save(const uint8_t *data, size_t len) override;
+  bool load(uint8_t *data, size_t len) override;
+
+ protected:
+  HostPreferences *prefs_;
+  uint32_t key_;
+};
+
 class HostPreferences : public ESPPreferences {
  public:
-  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override { return {}; }
+  explicit HostPreferences(std::string path) : path_(std::move(path)) {}
+
+  void open() {
+    this->fd_ = ::open(this->path_.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (this->fd_ < 0) {
+      ESP_LOGE(TAG, "Could not open %s: errno %d, preferences won't persist", this->path_.c_str(), errno);
+      return;
+    }
 
-  ESPPreferenceObject make_preference(size_t length, uint32_t type) override { return {}; }
+    std::vector<uint8_t> log;
+    struct stat st;
+    if (fstat(this->fd_, &st) == 0 && st.st_size > 0) {
+      log.resize(st.st_size);
+      if (pread(this->fd_, log.data(), log.size(), 0) != (ssize_t) log.size()) {
+        ESP_LOGE(TAG, "Could not read %s: errno %d", this->path_.c_str(), errno);
+        log.clear();
+      }
+    }
 
-  bool sync() override { return true; }
-  bool reset() override { return true; }
+    if (log.size() < FILE_HEADER_SIZE || read_u32(&log[0]) != PREFS_MAGIC || read_u32(&log[4]) != PREFS_VERSION) {
+      if (!log.empty())
+        ESP_LOGW(TAG, "%s is not a valid preferences file, starting over", this->path_.c_str());
+      this->compact_();
+      return;
+    }
+
+    size_t offset = FILE_HEADER_SIZE;
+    while (offset + RECORD_OVERHEAD <= log.size()) {
+      const uint32_t key = read_u32(&log[offset]);
+      const uint32_t len = read_u32(&log[offset + 4]);
+      if (len > log.size() - offset - RECORD_OVERHEAD)
+        break;
+      const size_t crc_offset = offset + 8 + len;
+      if (crc32(&log[offset], 8 + len) != read_u32(&log[crc_offset]))
+        break;
+      this->stored_[key].assign(&log[offset + 8], &log[crc_offset]);
+      offset = crc_offset + 4;
+    }
+    this->file_size_ = offset;
+    if (offset != log.size()) {
+      // Only the tail can be damaged, everything was appended with a single write
+      ESP_LOGW(TAG, "Dropping %zu bytes of incomplete or corrupt records from %s", log.size() - offset,
+               this->path_.c_str());
+      if (ftruncate(this->fd_, offset) != 0)
+        ESP_LOGE(TAG, "Could not truncate %s: errno %d", this->path_.c_str(), errno);
+    }
+    ESP_LOGV(TAG, "Loaded %zu preferences from %s (%zu bytes)", this->stored_.size(), this->path_.c_str(), offset);
+  }
+
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
+    return make_preference(length, type);
+  }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override {
+    auto *pref = new HostPreferenceBackend(this, type);  // NOLINT(cppcoreguidelines-owning-memory)
+    return ESPPreferenceObject(pref);
+  }
+
+  bool save(uint32_t key, const uint8_t *data, size_t len) {
+    this->pending_[key].assign(data, data + len);
+    return true;
+  }
+  bool load(uint32_t key, uint8_t *data, size_t len) {
+    auto it = this->pending_.find(key);
+    if (it == this->pending_.end()) {
+      it = this->stored_.find(key);
+      if (it == this->stored_.end())
+        return false;
+    }
+    if (it->second.size() != len)
+      return false;
+    memcpy(data, it->second.data(), len);
+    return true;
+  }
+
+  bool sync() override {
+    if (this->pending_.empty())
+      return true;
+    if (this->fd_ < 0 && this->reopen_)
+      this->compact_();  // Recreates the log from the stored records and opens it again
+    if (this->fd_ < 0)
+      return false;
+
+    const uint32_t start = micros();
+    std::vector<uint8_t> records;
+    size_t cached = 0, written = 0;
+    for (auto &pending : this->pending_) {
+      auto it = this->stored_.find(pending.first);
+      if (it != this->stored_.end() && it->second == pending.second) {
+        cached++;
+        continue;
+      }
+      append_record(records, pending.first, pending.second);
+      written++;
+    }
+
+    if (!records.empty()) {
+      if (!write_all(this->fd_, records.data(), records.size()) || fdatasync(this->fd_) != 0) {
+        ESP_LOGE(TAG, "Writing %zu preferences to %s failed: errno %d", written, this->path_.c_str(), errno);
+        // Cut off whatever part made it, the records stay pending for the next sync
+        if (ftruncate(this->fd_, this->file_size_) != 0)
+          ESP_LOGE(TAG, "Could not truncate %s: errno %d", this->path_.c_str(), errno);
+        return false;
+      }
+      this->file_size_ += records.size();
+      this->bytes_written_ += records.size();
+      this->fsyncs_++;
+    }
+    for (auto &pending : this->pending_)
+      this->stored_[pending.first] = std::move(pending.second);
+    this->pending_.clear();
+
+    if (this->file_size_ > COMPACT_MIN_SIZE && this->file_size_ > COMPACT_RATIO * this->live_size_())
+      this->compact_();
+
+    ESP_LOGV(TAG, "Saving %zu preferences: %zu cached, %zu written (%zu bytes) in %.2f ms", cached + written, cached,
+             written, records.size(), (micros() - start) / 1000.0f);
+    ESP_LOGV(TAG, "Totals: %" PRIu64 " bytes written in %" PRIu32 " fsyncs, %" PRIu32 " compactions, log %zu bytes",
+             this->bytes_written_, this->fsyncs_, this->compactions_, this->file_size_);
+    return true;
+  }
+
+  bool reset() override {
+    ESP_LOGD(TAG, "Cleaning up preferences in %s...", this->path_.c_str());
+    this->pending_.clear();
+    this->stored_.clear();
+    if (this->fd_ >= 0) {
+      ::close(this->fd_);
+      this->fd_ = -1;
+    }
+    // Leave fd_ closed to prevent any saves until restart
+    this->reopen_ = false;
+    return ::unlink(this->path_.c_str()) == 0 || errno == ENOENT;
+  }
+
+ protected:
+  size_t live_size_() const {
+    size_t size = FILE_HEADER_SIZE;
+    for (const auto &stored : this->stored_)
+      size += RECORD_OVERHEAD + stored.second.size();
+    return size;
+  }
+
+  /// Write the live records to a new file and atomically replace the log with it.
+  void compact_() {
+    std::vector<uint8_t> log;
+    log.reserve(this->live_size_());
+    append_u32(log, PREFS_MAGIC);
+    append_u32(log, PREFS_VERSION);
+    for (const auto &stored : this->stored_)
+      append_record(log, stored.first, stored.second);
+
+    const std::string tmp_path = this->path_ + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0 || !write_all(fd, log.data(), log.size()) || fdatasync(fd) != 0 ||
+        ::rename(tmp_path.c_str(), this->path_.c_str()) != 0) {
+      ESP_LOGE(TAG, "Compacting %s failed: errno %d", this->path_.c_str(), errno);
+      if (fd >= 0) {
+        ::close(fd);
+        ::unlink(tmp_path.c_str());
+      }
+      return;
+    }
+    ::close(fd);
+    this->sync_directory_();
+
+    if (this->fd_ >= 0)
+      ::close(this->fd_);
+    this->fd_ = ::open(this->path_.c_str(), O_RDWR | O_APPEND | O_CLOEXEC);
+    // Without a log, the next sync() compacts again, which creates the file anew
+    this->reopen_ = this->fd_ < 0;
+    if (this->reopen_)
+      ESP_LOGE(TAG, "Could not reopen %s after compacting: errno %d", this->path_.c_str(), errno);
+    this->file_size_ = log.size();
+    this->bytes_written_ += log.size();
+    this->fsyncs_ += 2;
+    this->compactions_++;
+    ESP_LOGV(TAG, "Compacted %s to %zu bytes", this->path_.c_str(), log.size());
+  }
+
+  /// Make the rename durable.
+  void sync_directory_() {
+    const size_t slash = this->path_.rfind('/');
+    const std::string dir = slash == std::string::npos ? "." : this->path_.substr(0, slash + 1);
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+      return;
+    fsync(fd);
+    ::close(fd);
+  }
+
+  std::string path_;
+  int fd_{-1};
+  bool reopen_{false};
+  size_t file_size_{0};
+  std::map<uint32_t, std::vector<uint8_t>> stored_;
+  std::map<uint32_t, std::vector<uint8_t>> pending_;
+
+  // Wear and latency statistics, comparable to the flash backends of the microcontroller platforms
+  uint64_t bytes_written_{0};
+  uint32_t fsyncs_{0};
+  uint32_t compactions_{0};
 };
 
+bool HostPreferenceBackend::save(const uint8_t *data, size_t len) { return this->prefs_->save(this->key_, data, len); }
+bool HostPreferenceBackend::load(uint8_t *data, size_t len) { return this->prefs_->load(this->key_, data, len); }
+
 void setup_preferences() {
-  auto *pref = new HostPreferences();  // NOLINT(cppcoreguidelines-owning-memory)
+  auto *pref = new HostPreferences(ESPHOME_HOST_PREFERENCES_FILE);  // NOLINT(cppcoreguidelines-owning-memory)
+  pref->open();
   global_preferences = pref;
 }
 
@@ -34,14 +34,10 @@ void ILI9XXXDisplay::setup() {
     mad |= MADCTL_MY;
   this->send_command(ILI9XXX_MADCTL, &mad, 1);
 
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
-
   if (this->buffer_color_mode_ == BITS_16) {
     this->init_internal_(this->get_buffer_length_() * 2);
     if (this->buffer_ != nullptr) {
+      this->init_dirty_tracking_(2);
       return;
     }
     this->buffer_color_mode_ = BITS_8;
@@ -49,7 +45,9 @@ void ILI9XXXDisplay::setup() {
   this->init_internal_(this->get_buffer_length_());
   if (this->buffer_ == nullptr) {
     this->mark_failed();
+    return;
   }
+  this->init_dirty_tracking_(1);
 }
 
 void ILI9XXXDisplay::setup_pins_() {
@@ -103,10 +101,7 @@ float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWA
 
 void ILI9XXXDisplay::fill(Color color) {
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->mark_all_dirty_();
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
@@ -165,17 +160,53 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     this->buffer_[pos] = new_color;
     updated = true;
   }
-  if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+  if (updated)
+    this->mark_dirty_(x, y);
+}
+
+uint16_t ILI9XXXDisplay::convert_color_(Color color) const {
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      return display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+    case BITS_16:
+      return display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+    default:
+      return display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+  }
+}
+
+void HOT ILI9XXXDisplay::fill_rect_internal_(int x, int y, int width, int height, Color color) {
+  const uint16_t new_color = this->convert_color_(color);
+  for (int row = y; row < y + height; row++) {
+    const uint32_t pos = row * this->width_ + x;
+    if (this->buffer_color_mode_ == BITS_16) {
+      uint8_t *data = this->buffer_ + pos * 2;
+      for (int i = 0; i < width; i++) {
+        *data++ = new_color >> 8;
+        *data++ = new_color;
+      }
+    } else {
+      memset(this->buffer_ + pos, new_color, width);
+    }
   }
+  this->mark_dirty_(x, y, width, height);
+}
+
+void HOT ILI9XXXDisplay::write_pixels_internal_(int x, int y, int dx, int dy, const Color *colors, int count) {
+  const int32_t step = dx + dy * this->width_;
+  int32_t pos = y * this->width_ + x;
+  for (int i = 0; i < count; i++, pos += step) {
+    const uint16_t new_color = this->convert_color_(colors[i]);
+    if (this->buffer_color_mode_ == BITS_16) {
+      this->buffer_[pos * 2] = new_color >> 8;
+      this->buffer_[pos * 2 + 1] = new_color;
+    } else {
+      this->buffer_[pos] = new_color;
+    }
+  }
+  const int x2 = x + dx * (count - 1);
+  const int y2 = y + dy * (count - 1);
+  this->mark_dirty_(std::min(x, x2), std::min(y, y2), abs(x2 - x) + 1, abs(y2 - y) + 1);
 }
 
 void ILI9XXXDisplay::update() {
@@ -193,17 +224,29 @@ void ILI9XXXDisplay::update() {
 }
 
 void ILI9XXXDisplay::display_() {
+  auto now = millis();
+  this->sent_rows_.clear();
+  size_t bytes = this->flush_dirty_();
+  if (bytes != 0)
+    ESP_LOGV(TAG, "Data write of %zu bytes took %dms", bytes, (unsigned) (millis() - now));
+}
+
+size_t ILI9XXXDisplay::write_window_(const display::Rect &window) {
   uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
-    ESP_LOGV(TAG, "Nothing to display");
-    return;
+  const uint16_t x_low = window.x;
+  const uint16_t y_low = window.y;
+  const uint16_t x_high = window.x2() - 1;
+  const uint16_t y_high = window.y2() - 1;
+  size_t const w = window.w;
+  size_t const h = window.h;
+  size_t bytes = 0;
+
+  // Full rows written by an earlier window of this flush may already cover this one
+  for (auto &rows : this->sent_rows_) {
+    if (y_low >= rows.first && y_high < rows.second)
+      return 0;
   }
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
-
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
   size_t sw_time = this->width_ * h * 16 / mhz + this->width_ * h * 2 / SPI_MAX_BLOCK_SIZE * SPI_SETUP_US * 2;
@@ -212,22 +255,40 @@ void ILI9XXXDisplay::display_() {
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%d, mode=%d, 18bit=%d, sw_time=%dus, mw_time=%dus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
-  auto now = millis();
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   this->enable();
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
-    // 16 bit mode maps directly to display format
-    ESP_LOGV(TAG, "Doing single write of %d bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    // 16 bit mode maps directly to display format. Windows next to each other share rows, only write the rows that
+    // no earlier window of this flush wrote.
+    int y = y_low;
+    while (y <= y_high) {
+      int y_end = y_high + 1;
+      bool sent = false;
+      for (auto &rows : this->sent_rows_) {
+        if (y >= rows.first && y < rows.second) {
+          y = rows.second;
+          sent = true;
+          break;
+        }
+        if (rows.first > y)
+          y_end = std::min<int>(y_end, rows.first);
+      }
+      if (sent)
+        continue;
+      ESP_LOGV(TAG, "Doing single write of %d bytes", this->width_ * (y_end - y) * 2);
+      set_addr_window_(0, y, this->width_ - 1, y_end - 1);
+      this->write_array(this->buffer_ + y * this->width_ * 2, (y_end - y) * this->width_ * 2);
+      bytes += (y_end - y) * this->width_ * 2;
+      y = y_end;
+    }
+    this->sent_rows_.emplace_back(y_low, y_high + 1);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x_low, y_low, x_high, y_high);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y_low * this->width_ + x_low;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -253,6 +314,7 @@ void ILI9XXXDisplay::display_() {
       }
       if (idx == ILI9XXX_TRANSFER_BUFFER_SIZE) {
         this->write_array(transfer_buffer, idx);
+        bytes += idx;
         idx = 0;
         App.feed_wdt();
       }
@@ -265,15 +327,11 @@ void ILI9XXXDisplay::display_() {
     // flush any balance.
     if (idx != 0) {
       this->write_array(transfer_buffer, idx);
+      bytes += idx;
     }
   }
   this->disable();
-  ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  return bytes;
 }
 
 // should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
@@ -87,9 +87,14 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_rect_internal_(int x, int y, int width, int height, Color color) override;
+  void write_pixels_internal_(int x, int y, int dx, int dy, const Color *colors, int count) override;
+  /// Convert the color to the format of the buffer.
+  uint16_t convert_color_(Color color) const;
   void setup_pins_();
 
   void display_();
+  size_t write_window_(const display::Rect &window) override;
   void init_lcd_();
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -99,10 +104,6 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
   const uint8_t *palette_;
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -120,6 +121,9 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   GPIOPin *dc_pin_{nullptr};
   GPIOPin *busy_pin_{nullptr};
 
+  /// Rows [first, second) written as full rows by the current flush.
+  std::vector<std::pair<uint16_t, uint16_t>> sent_rows_;
+
   bool prossing_update_ = false;
   bool need_update_ = false;
   bool is_18bitdisplay_ = false;
@@ -8,56 +8,37 @@ namespace image {
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      // Draw the runs of equal pixels in every row as spans
+      for (int img_y = 0; img_y < height_; img_y++) {
+        int run_start = 0;
+        bool run_on = this->get_binary_pixel_(0, img_y);
+        for (int img_x = 1; img_x <= width_; img_x++) {
+          const bool on = img_x < width_ && this->get_binary_pixel_(img_x, img_y);
+          if (img_x < width_ && on == run_on)
+            continue;
+          if (run_on) {
+            display->fill_span(x + run_start, y + img_y, img_x - run_start, color_on);
           } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
+            display->fill_span(x + run_start, y + img_y, img_x - run_start, color_off);
           }
+          run_start = img_x;
+          run_on = on;
         }
       }
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      display->blit_rect(x, y, width_, height_, this->data_start_, display::PixelFormat::GRAYSCALE,
+                         this->transparent_);
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      display->blit_rect(x, y, width_, height_, this->data_start_, display::PixelFormat::RGB565, this->transparent_);
       break;
     case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      display->blit_rect(x, y, width_, height_, this->data_start_, display::PixelFormat::RGB24, this->transparent_);
       break;
     case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      display->blit_rect(x, y, width_, height_, this->data_start_, display::PixelFormat::RGBA, this->transparent_);
       break;
   }
 }
@@ -1,5 +1,10 @@
 #include "json_util.h"
 #include "esphome/core/log.h"
+#include "esphome/core/string_ref.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 
 #ifdef USE_ESP8266
 #include <Esp.h>
@@ -17,6 +22,8 @@ namespace json {
 static const char *const TAG = "json";
 
 static std::vector<char> global_json_build_buffer;  // NOLINT
+/// Largest document size build_json() needed so far, so that big documents don't go through the retry loop every time.
+static size_t global_json_build_size = 512;  // NOLINT
 
 std::string build_json(const json_build_t &f) {
   // Here we are allocating up to 5kb of memory,
@@ -33,7 +40,7 @@ std::string build_json(const json_build_t &f) {
   const size_t free_heap = lt_heap_get_free();
 #endif
 
-  size_t request_size = std::min(free_heap, (size_t) 512);
+  size_t request_size = std::min(free_heap, global_json_build_size);
   while (true) {
     ESP_LOGV(TAG, "Attempting to allocate %u bytes for JSON serialization", request_size);
     DynamicJsonDocument json_document(request_size);
@@ -54,6 +61,7 @@ std::string build_json(const json_build_t &f) {
       request_size = std::min(request_size * 2, free_heap);
       continue;
     }
+    global_json_build_size = std::max(global_json_build_size, request_size);
     json_document.shrinkToFit();
     ESP_LOGV(TAG, "Size after shrink %u bytes", json_document.capacity());
     std::string output;
@@ -108,5 +116,91 @@ void parse_json(const std::string &data, const json_parse_t &f) {
   } while (!pass);
 }
 
+void JsonWriter::value_(const StringRef &value) { this->string_(value.c_str(), value.size()); }
+
+void JsonWriter::string_(const char *value, size_t len) {
+  static const char *const HEX_CHARS = "0123456789abcdef";
+  this->output_ += '"';
+  const char *run = value;
+  const char *end = value + len;
+  for (const char *p = value; p != end; p++) {
+    const uint8_t c = *p;
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Copy unescaped characters in runs instead of one by one
+    this->output_.append(run, p - run);
+    run = p + 1;
+    this->output_ += '\\';
+    switch (c) {
+      case '"':
+      case '\\':
+        this->output_ += char(c);
+        break;
+      case '\b':
+        this->output_ += 'b';
+        break;
+      case '\f':
+        this->output_ += 'f';
+        break;
+      case '\n':
+        this->output_ += 'n';
+        break;
+      case '\r':
+        this->output_ += 'r';
+        break;
+      case '\t':
+        this->output_ += 't';
+        break;
+      default:
+        this->output_ += "u00";
+        this->output_ += HEX_CHARS[c >> 4];
+        this->output_ += HEX_CHARS[c & 0x0F];
+        break;
+    }
+  }
+  this->output_.append(run, end - run);
+  this->output_ += '"';
+}
+
+void JsonWriter::int_(int64_t value) {
+  if (value < 0) {
+    this->output_ += '-';
+    // Negate as unsigned, so that the minimum value doesn't overflow
+    this->uint_(~uint64_t(value) + 1);
+  } else {
+    this->uint_(value);
+  }
+}
+
+void JsonWriter::uint_(uint64_t value) {
+  char buf[20];
+  char *p = buf + sizeof(buf);
+  do {
+    *--p = char('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  this->output_.append(p, buf + sizeof(buf) - p);
+}
+
+void JsonWriter::float_(double value, bool single_precision) {
+  // JSON has no representation for them, ArduinoJson also writes null
+  if (std::isnan(value) || std::isinf(value)) {
+    this->output_ += "null";
+    return;
+  }
+  // Shortest representation that reads back as the same value, so 0.1f is written as 0.1 and not 0.100000001
+  char buf[32];
+  const int max_precision = single_precision ? 9 : 17;
+  for (int precision = 6;; precision++) {
+    snprintf(buf, sizeof(buf), "%.*g", precision, value);
+    if (precision == max_precision)
+      break;
+    const double parsed = strtod(buf, nullptr);
+    if (single_precision ? float(parsed) == float(value) : parsed == value)
+      break;
+  }
+  this->output_ += buf;
+}
+
 }  // namespace json
 }  // namespace esphome
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "esphome/core/helpers.h"
@@ -11,6 +16,9 @@
 #include <ArduinoJson.h>
 
 namespace esphome {
+
+class StringRef;
+
 namespace json {
 
 /// Callback function typedef for parsing JsonObjects.
@@ -25,5 +33,132 @@ std::string build_json(const json_build_t &f);
 /// Parse a JSON string and run the provided json parse function if it's valid.
 void parse_json(const std::string &data, const json_parse_t &f);
 
+/** Streaming JSON serializer that writes straight into a caller-provided string.
+ *
+ * Unlike build_json() there is no intermediate document whose size has to be guessed, the output is produced in a
+ * single pass. Passing the same string for every message also reuses its capacity. The writer doesn't check the
+ * structure: every begin_*() needs a matching end_*(), and keys of an object have to be unique.
+ *
+ * ```cpp
+ * std::string out;
+ * json::JsonWriter writer(out);
+ * writer.begin_object();
+ * writer.add("id", "sensor-temperature");
+ * writer.add("value", 23.5f);
+ * writer.begin_array("options");
+ * writer.add("a");
+ * writer.end_array();
+ * writer.end_object();
+ * ```
+ */
+class JsonWriter {
+ public:
+  /// Append to output, which is not cleared.
+  explicit JsonWriter(std::string &output) : output_(output) {}
+
+  /// Start an object, either the root or an element of an array.
+  void begin_object() {
+    this->separator_();
+    this->open_('{');
+  }
+  /// Start an object as a member of the current object.
+  void begin_object(const char *key) {
+    this->key_(key);
+    this->open_('{');
+  }
+  void end_object() { this->close_('}'); }
+  /// Start an array, either the root or an element of an array.
+  void begin_array() {
+    this->separator_();
+    this->open_('[');
+  }
+  /// Start an array as a member of the current object.
+  void begin_array(const char *key) {
+    this->key_(key);
+    this->open_('[');
+  }
+  void end_array() { this->close_(']'); }
+
+  /// Add a member to the current object.
+  template<typename T> void add(const char *key, const T &value) {
+    this->key_(key);
+    this->value_(value);
+  }
+  /// Add an element to the current array.
+  template<typename T> void add(const T &value) {
+    this->separator_();
+    this->value_(value);
+  }
+  /// Add a member with a null value to the current object.
+  void add_null(const char *key) {
+    this->key_(key);
+    this->output_ += "null";
+  }
+
+ protected:
+  void separator_() {
+    if (!this->first_)
+      this->output_ += ',';
+    this->first_ = false;
+  }
+  void open_(char c) {
+    this->output_ += c;
+    this->first_ = true;
+  }
+  void close_(char c) {
+    this->output_ += c;
+    this->first_ = false;
+  }
+  void key_(const char *key) {
+    this->separator_();
+    this->string_(key);
+    this->output_ += ':';
+  }
+
+  void value_(const char *value) { this->string_(value); }
+  void value_(const std::string &value) { this->string_(value.c_str(), value.size()); }
+  void value_(const StringRef &value);
+  void value_(bool value) { this->output_ += value ? "true" : "false"; }
+  void value_(float value) { this->float_(value, true); }
+  void value_(double value) { this->float_(value, false); }
+  template<typename T> typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type value_(
+      T value) {
+    this->int_(value);
+  }
+  template<typename T> typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type value_(
+      T value) {
+    this->uint_(value);
+  }
+  template<typename T> typename std::enable_if<std::is_enum<T>::value>::type value_(T value) {
+    this->int_(static_cast<int64_t>(value));
+  }
+
+  void string_(const char *value) { this->string_(value, strlen(value)); }
+  void string_(const char *value, size_t len);
+  void int_(int64_t value);
+  void uint_(uint64_t value);
+  void float_(double value, bool single_precision);
+
+  std::string &output_;
+  /// Whether the next member or element is the first of its object or array, and must not be preceded by a comma.
+  bool first_{true};
+};
+
+/// Append a JSON object to output, with its members written by the provided function.
+template<typename F> void write_json(std::string &output, F &&f) {
+  JsonWriter writer(output);
+  writer.begin_object();
+  f(writer);
+  writer.end_object();
+}
+
+/// Build a JSON object string with its members written by the provided function, the streaming counterpart of
+/// build_json().
+template<typename F> std::string write_json(F &&f) {
+  std::string output;
+  write_json(output, std::forward<F>(f));
+  return output;
+}
+
 }  // namespace json
 }  // namespace esphome
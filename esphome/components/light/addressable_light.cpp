@@ -95,13 +95,8 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   alpha255 = clamp(alpha255, 0.0f, 255.0f);
   auto alpha8 = static_cast<uint8_t>(alpha255);
 
-  if (alpha8 != 0) {
-    uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
-
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
-  }
+  if (alpha8 != 0)
+    this->light_.all().blend(this->target_color_, alpha8);
 
   this->last_transition_progress_ = smoothed_progress;
   this->light_.schedule_show();
@@ -83,6 +83,7 @@ class AddressableLight : public LightOutput, public Component {
 
  protected:
   friend class AddressableLightTransformer;
+  friend class ESPRangeView;
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
@@ -96,6 +97,9 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// Lights that keep their LEDs in one contiguous buffer describe it here, so that range operations can work on the
+  /// buffer directly instead of going through an ESPColorView for every LED.
+  virtual ESPPixelBuffer get_pixel_buffer_internal() const { return {}; }
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
@@ -168,9 +168,7 @@ class AddressableScanEffect : public AddressableLightEffect {
     this->last_move_ = now;
 
     it.all() = Color::BLACK;
-    for (uint32_t i = 0; i < this->scan_width_; i++) {
-      it[this->at_led_ + i] = current_color;
-    }
+    it.range(this->at_led_, this->at_led_ + this->scan_width_) = current_color;
 
     it.schedule_show();
   }
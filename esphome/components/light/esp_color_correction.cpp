@@ -5,7 +5,12 @@
 namespace esphome {
 namespace light {
 
+/// Correction tables of the light that used them last, see get_correction_table().
+static uint8_t correction_table[4][256];                            // NOLINT
+static const ESPColorCorrection *correction_table_owner = nullptr;  // NOLINT
+
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
+  this->correction_table_valid_ = false;
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
     auto corrected = to_uint8_scale(gamma_correct(i / 255.0f, gamma));
@@ -23,5 +28,21 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   }
 }
 
+const uint8_t *ESPColorCorrection::get_correction_table(uint8_t channel) {
+  if (!this->correction_table_valid_ || correction_table_owner != this)
+    this->calculate_correction_table_();
+  return correction_table[channel];
+}
+
+void ESPColorCorrection::calculate_correction_table_() {
+  for (uint16_t i = 0; i < 256; i++) {
+    Color corrected = this->color_correct(Color(i, i, i, i));
+    for (uint8_t channel = 0; channel < 4; channel++)
+      correction_table[channel][i] = corrected.raw[channel];
+  }
+  correction_table_owner = this;
+  this->correction_table_valid_ = true;
+}
+
 }  // namespace light
 }  // namespace esphome
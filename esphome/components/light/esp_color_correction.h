@@ -8,9 +8,23 @@ namespace light {
 class ESPColorCorrection {
  public:
   ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
-  void set_max_brightness(const Color &max_brightness) { this->max_brightness_ = max_brightness; }
-  void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
+  void set_max_brightness(const Color &max_brightness) {
+    this->max_brightness_ = max_brightness;
+    this->correction_table_valid_ = false;
+  }
+  void set_local_brightness(uint8_t local_brightness) {
+    if (local_brightness == this->local_brightness_)
+      return;
+    this->local_brightness_ = local_brightness;
+    this->correction_table_valid_ = false;
+  }
   void calculate_gamma_table(float gamma);
+  /** Lookup table with the combined brightness and gamma correction of one channel (0-3 for red, green, blue and
+   * white), for correcting many values at once. table[x] is equal to color_correct_<channel>(x).
+   *
+   * The tables are shared by all lights, they are only valid until get_correction_table() is called for another one.
+   */
+  const uint8_t *get_correction_table(uint8_t channel);
   inline Color color_correct(Color color) const ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
     return Color(this->color_correct_red(color.red), this->color_correct_green(color.green),
@@ -67,8 +81,11 @@ class ESPColorCorrection {
   }
 
  protected:
+  void calculate_correction_table_();
+
   uint8_t gamma_table_[256];
   uint8_t gamma_reverse_table_[256];
+  bool correction_table_valid_{false};
   Color max_brightness_;
   uint8_t local_brightness_{255};
 };
@@ -1,6 +1,9 @@
 #include "esp_range_view.h"
 #include "addressable_light.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -18,48 +21,180 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
-  for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+  ESPPixelBuffer buffer = this->parent_->get_pixel_buffer_internal();
+  if (buffer.pixels == nullptr) {
+    for (int32_t i = this->begin_; i < this->end_; i++) {
+      (*this->parent_)[i] = color;
+    }
+    return;
+  }
+  if (this->size() == 0)
+    return;
+
+  const Color corrected = this->parent_->correction_.color_correct(color);
+  uint8_t *begin = buffer.pixels + this->begin_ * buffer.stride;
+  const size_t length = size_t(this->size()) * buffer.stride;
+  for (uint8_t c = 0; c < buffer.channels; c++)
+    begin[buffer.offsets[c]] = corrected.raw[c];
+  if (buffer.stride == buffer.channels) {
+    // Records consist of color channels only, fill the rest of the range by copying the first record in doubling
+    // chunks, so that memcpy can work with whole words.
+    for (size_t filled = buffer.stride; filled < length; filled *= 2)
+      memcpy(begin + filled, begin, std::min(filled, length - filled));
+    return;
+  }
+  for (uint8_t *pixel = begin + buffer.stride; pixel < begin + length; pixel += buffer.stride) {
+    for (uint8_t c = 0; c < buffer.channels; c++)
+      pixel[buffer.offsets[c]] = corrected.raw[c];
   }
 }
 
+bool ESPRangeView::set_channel_(uint8_t channel, uint8_t value) {
+  ESPPixelBuffer buffer = this->parent_->get_pixel_buffer_internal();
+  if (buffer.pixels == nullptr)
+    return false;
+  if (channel >= buffer.channels)
+    return true;
+  const uint8_t corrected = this->parent_->correction_.color_correct(Color(value, value, value, value)).raw[channel];
+  uint8_t *end = buffer.pixels + this->end_ * buffer.stride;
+  for (uint8_t *pixel = buffer.pixels + this->begin_ * buffer.stride; pixel < end; pixel += buffer.stride)
+    pixel[buffer.offsets[channel]] = corrected;
+  return true;
+}
+
 void ESPRangeView::set_red(uint8_t red) {
+  if (this->set_channel_(0, red))
+    return;
   for (auto c : *this)
     c.set_red(red);
 }
 void ESPRangeView::set_green(uint8_t green) {
+  if (this->set_channel_(1, green))
+    return;
   for (auto c : *this)
     c.set_green(green);
 }
 void ESPRangeView::set_blue(uint8_t blue) {
+  if (this->set_channel_(2, blue))
+    return;
   for (auto c : *this)
     c.set_blue(blue);
 }
 void ESPRangeView::set_white(uint8_t white) {
+  if (this->set_channel_(3, white))
+    return;
   for (auto c : *this)
     c.set_white(white);
 }
 void ESPRangeView::set_effect_data(uint8_t effect_data) {
+  ESPPixelBuffer buffer = this->parent_->get_pixel_buffer_internal();
+  if (buffer.effect_data != nullptr) {
+    memset(buffer.effect_data + this->begin_, effect_data, this->size());
+    return;
+  }
   for (auto c : *this)
     c.set_effect_data(effect_data);
 }
 
+/// Table of map_(), shared by all its instantiations and lights. Lights are only changed from the main loop.
+static uint8_t range_map[4][256];  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename F> void ESPRangeView::map_(F f) {
+  ESPPixelBuffer buffer = this->parent_->get_pixel_buffer_internal();
+  if (buffer.pixels == nullptr) {
+    for (auto c : *this)
+      c.set(f(c.get()));
+    return;
+  }
+
+  ESPColorCorrection &correction = this->parent_->correction_;
+  const uint8_t *tables[4];
+  for (uint8_t c = 0; c < buffer.channels; c++)
+    tables[c] = correction.get_correction_table(c);
+  uint8_t *begin = buffer.pixels + this->begin_ * buffer.stride;
+  uint8_t *end = buffer.pixels + this->end_ * buffer.stride;
+
+  if (this->size() < 256) {
+    // Not worth building a table for a few LEDs
+    for (uint8_t *pixel = begin; pixel < end; pixel += buffer.stride) {
+      Color raw;
+      for (uint8_t c = 0; c < buffer.channels; c++)
+        raw.raw[c] = pixel[buffer.offsets[c]];
+      const Color color = f(correction.color_uncorrect(raw));
+      for (uint8_t c = 0; c < buffer.channels; c++)
+        pixel[buffer.offsets[c]] = tables[c][color.raw[c]];
+    }
+    return;
+  }
+
+  // As every channel is mapped independently, the new value of a channel only depends on its current value. Compute
+  // that for all 256 possible values once, then run the whole buffer through the table.
+  for (uint16_t i = 0; i < 256; i++) {
+    const Color color = f(correction.color_uncorrect(Color(i, i, i, i)));
+    for (uint8_t c = 0; c < buffer.channels; c++)
+      range_map[c][i] = tables[c][color.raw[c]];
+  }
+  for (uint8_t c = 0; c < buffer.channels; c++) {
+    const uint8_t *channel_map = range_map[c];
+    for (uint8_t *value = begin + buffer.offsets[c]; value < end; value += buffer.stride)
+      *value = channel_map[*value];
+  }
+}
+
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  this->map_([amnt](Color c) { return c.fade_to_white(amnt); });
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  this->map_([amnt](Color c) { return c.fade_to_black(amnt); });
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  this->map_([delta](Color c) { return c.lighten(delta); });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  this->map_([delta](Color c) { return c.darken(delta); });
+}
+void ESPRangeView::scale(uint8_t scale) {
+  this->map_([scale](Color c) { return c * scale; });
+}
+void ESPRangeView::blend(const Color &color, uint8_t alpha) {
+  const Color add = color * alpha;
+  const uint8_t inv_alpha = 255 - alpha;
+  this->map_([add, inv_alpha](Color c) { return add + c * inv_alpha; });
+}
+
+void ESPRangeView::set_from_buffer(const uint8_t *data, uint8_t channels) {
+  ESPPixelBuffer buffer = this->parent_->get_pixel_buffer_internal();
+  if (buffer.pixels == nullptr) {
+    for (int32_t i = this->begin_; i < this->end_; i++, data += channels) {
+      if (channels == 1) {
+        (*this->parent_)[i] = Color(data[0], data[0], data[0], data[0]);
+      } else {
+        (*this->parent_)[i] = Color(data[0], data[1], data[2], channels == 4 ? data[3] : 0);
+      }
+    }
+    return;
+  }
+
+  ESPColorCorrection &correction = this->parent_->correction_;
+  const uint8_t *red = correction.get_correction_table(0);
+  const uint8_t *green = correction.get_correction_table(1);
+  const uint8_t *blue = correction.get_correction_table(2);
+  const uint8_t *white = correction.get_correction_table(3);
+  const uint8_t r = buffer.offsets[0], g = buffer.offsets[1], b = buffer.offsets[2], w = buffer.offsets[3];
+  const bool has_white = buffer.channels == 4;
+  // Mono input uses its single value for all channels
+  const uint8_t green_src = channels == 1 ? 0 : 1, blue_src = channels == 1 ? 0 : 2;
+  uint8_t *end = buffer.pixels + this->end_ * buffer.stride;
+  for (uint8_t *pixel = buffer.pixels + this->begin_ * buffer.stride; pixel < end;
+       pixel += buffer.stride, data += channels) {
+    pixel[r] = red[data[0]];
+    pixel[g] = green[data[green_src]];
+    pixel[b] = blue[data[blue_src]];
+    if (has_white)
+      pixel[w] = white[channels == 3 ? 0 : data[channels - 1]];
+  }
 }
+
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
   if (rhs.size() != this->size())
@@ -75,6 +210,25 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   if (rhs.begin_ == this->begin_)
     return *this;
 
+  ESPPixelBuffer buffer = this->parent_->get_pixel_buffer_internal();
+  if (buffer.pixels != nullptr) {
+    // Same light, so the corrected values can be copied as they are.
+    uint8_t *dst = buffer.pixels + this->begin_ * buffer.stride;
+    const uint8_t *src = buffer.pixels + rhs.begin_ * buffer.stride;
+    if (buffer.stride == buffer.channels) {
+      memmove(dst, src, size_t(this->size()) * buffer.stride);
+      return *this;
+    }
+    const int32_t size = this->size();
+    for (int32_t n = 0; n < size; n++) {
+      // Copy in the direction that doesn't overwrite records before they are read
+      const int32_t i = rhs.begin_ > this->begin_ ? n : size - 1 - n;
+      for (uint8_t c = 0; c < buffer.channels; c++)
+        dst[i * buffer.stride + buffer.offsets[c]] = src[i * buffer.stride + buffer.offsets[c]];
+    }
+    return *this;
+  }
+
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
@@ -11,6 +11,23 @@ int32_t interpret_index(int32_t index, int32_t size);
 class AddressableLight;
 class ESPRangeIterator;
 
+/**
+ * Layout of the raw output buffer of an addressable light that stores its LEDs as one array of fixed-size records,
+ * used by the bulk operations of ESPRangeView. The values in the buffer are brightness and gamma corrected.
+ */
+struct ESPPixelBuffer {
+  /// First byte of the record of LED 0, nullptr if the light has no such buffer.
+  uint8_t *pixels{nullptr};
+  /// One byte of effect data per LED.
+  uint8_t *effect_data{nullptr};
+  /// Size of the record of a single LED.
+  uint8_t stride{0};
+  /// Number of channels, 3 for RGB and 4 for RGBW.
+  uint8_t channels{3};
+  /// Offset of the red, green, blue and white channel within a record.
+  uint8_t offsets[4]{0, 1, 2, 3};
+};
+
 /**
  * A half-open range of LEDs, inclusive of the begin index and exclusive of the end index, using zero-based numbering.
  */
@@ -37,6 +54,16 @@ class ESPRangeView : public ESPColorSettable {
   void fade_to_black(uint8_t amnt) override;
   void lighten(uint8_t delta) override;
   void darken(uint8_t delta) override;
+  /// Scale all LEDs by scale/255, like `Color * scale`.
+  void scale(uint8_t scale);
+  /// Blend all LEDs towards color by alpha/255, `color * alpha + led * (255 - alpha)`.
+  void blend(const Color &color, uint8_t alpha);
+  /** Set the LEDs from a buffer of size() packed colors.
+   *
+   * @param data The colors, channels bytes per LED.
+   * @param channels 1 for mono (the value is used for all channels), 3 for RGB (white is set to 0) or 4 for RGBW.
+   */
+  void set_from_buffer(const uint8_t *data, uint8_t channels);
 
   ESPRangeView &operator=(const Color &rhs) {
     this->set(rhs);
@@ -55,6 +82,11 @@ class ESPRangeView : public ESPColorSettable {
  protected:
   friend ESPRangeIterator;
 
+  /// Apply f to the uncorrected color of every LED. f must treat every channel independently.
+  template<typename F> void map_(F f);
+  /// Set one channel of all LEDs in the pixel buffer, returns false if the light has none.
+  bool set_channel_(uint8_t channel, uint8_t value);
+
   AddressableLight *parent_;
   int32_t begin_;
   int32_t end_;
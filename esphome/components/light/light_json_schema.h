@@ -13,8 +13,8 @@ namespace light {
 
 class LightJSONSchema {
  public:
-  /// Dump the state of a light as JSON.
-  static void dump_json(LightState &state, JsonObject root);
+  /// Write the state of a light as members of the current JSON object.
+  static void dump_json(LightState &state, json::JsonWriter &writer);
   /// Parse the JSON state of a light to a LightCall.
   static void parse_json(LightState &state, LightCall &call, JsonObject root);
 
@@ -20,6 +20,7 @@ from esphome.const import (
     PLATFORM_BK72XX,
     PLATFORM_RTL87XX,
     PLATFORM_ESP32,
+    PLATFORM_HOST,
     PLATFORM_ESP8266,
     PLATFORM_RP2040,
 )
@@ -158,14 +159,35 @@ LoggerMessageTrigger = logger_ns.class_(
     "LoggerMessageTrigger",
     automation.Trigger.template(cg.int_, cg.const_char_ptr, cg.const_char_ptr),
 )
+SetLogLevelAction = logger_ns.class_("SetLogLevelAction", automation.Action)
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_ASYNC_BUFFER_SIZE = "async_buffer_size"
+
+
+def validate_async_buffer_size(config):
+    # A message can take at most half of the buffer
+    if CONF_ASYNC_BUFFER_SIZE in config:
+        minimum = 4 * config[CONF_TX_BUFFER_SIZE]
+        if config[CONF_ASYNC_BUFFER_SIZE] < minimum:
+            raise cv.Invalid(
+                f"{CONF_ASYNC_BUFFER_SIZE} must be at least four times {CONF_TX_BUFFER_SIZE} ({minimum} bytes)",
+                path=[CONF_ASYNC_BUFFER_SIZE],
+            )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(Logger),
             cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
             cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+            cv.Optional(CONF_ASYNC_BUFFER_SIZE): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]),
+                cv.validate_bytes,
+                cv.int_range(min=1024, max=65536),
+            ),
             cv.Optional(CONF_DEASSERT_RTS_DTR, default=False): cv.boolean,
             cv.SplitDefault(
                 CONF_HARDWARE_UART,
@@ -208,6 +230,7 @@ CONFIG_SCHEMA = cv.All(
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
+    validate_async_buffer_size,
 )
 
 
@@ -221,6 +244,9 @@ async def to_code(config):
                 HARDWARE_UART_TO_UART_SELECTION[config[CONF_HARDWARE_UART]]
             )
         )
+    if CONF_ASYNC_BUFFER_SIZE in config:
+        cg.add_define("USE_LOGGER_ASYNC")
+        cg.add(log.set_async_buffer_size(config[CONF_ASYNC_BUFFER_SIZE]))
     cg.add(log.pre_setup())
 
     for tag, level in config[CONF_LOGS].items():
@@ -336,3 +362,24 @@ async def logger_log_action_to_code(config, action_id, template_arg, args):
 
     lambda_ = await cg.process_lambda(Lambda(text), args, return_type=cg.void)
     return cg.new_Pvariable(action_id, template_arg, lambda_)
+
+
+@automation.register_action(
+    "logger.set_level",
+    SetLogLevelAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(Logger),
+            cv.Required(CONF_TAG): cv.templatable(cv.string),
+            cv.Required(CONF_LEVEL): cv.templatable(is_log_level),
+        }
+    ),
+)
+async def logger_set_level_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    tag = await cg.templatable(config[CONF_TAG], args, cg.std_string)
+    cg.add(var.set_tag(tag))
+    level = await cg.templatable(config[CONF_LEVEL], args, cg.int_, to_exp=LOG_LEVELS)
+    cg.add(var.set_level(level))
+    return var
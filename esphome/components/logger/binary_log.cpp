@@ -0,0 +1,458 @@
+#include "binary_log.h"
+
+#ifdef USE_LOGGER_BINARY
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <sys/types.h>
+
+#ifdef USE_ESP32
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include <esp_memory_utils.h>
+#else
+#include <soc/soc_memory_layout.h>
+#endif
+#endif
+
+#if defined(USE_HOST) && defined(__linux__)
+// Provided by the default linker script, the image holds the code, read-only data and initialized data
+extern "C" char __executable_start[];  // NOLINT
+extern "C" char edata[];               // NOLINT
+#endif
+
+namespace esphome {
+namespace logger {
+
+/// Whether the string is part of the firmware image, so that the host can read it from the ELF file.
+static bool is_in_image(const char *str) {
+#if defined(USE_ESP32)
+  return esp_ptr_in_drom(str);
+#elif defined(USE_HOST) && defined(__linux__)
+  return str >= __executable_start && str < edata;
+#else
+  return false;
+#endif
+}
+
+enum LengthModifier : uint8_t { LENGTH_NONE, LENGTH_HH, LENGTH_H, LENGTH_L, LENGTH_LL, LENGTH_J, LENGTH_Z, LENGTH_T, LENGTH_BIG_L };
+
+/// A conversion specification of a format string, without the '*' width and precision.
+struct FormatSpec {
+  char flags[8];
+  int width;
+  int precision;
+  bool width_star;
+  bool precision_star;
+  LengthModifier length;
+  char conversion;
+};
+
+/// Parse the conversion specification after a '%', returns a pointer after it.
+static const char *parse_spec(const char *format, FormatSpec *spec) {
+  uint8_t num_flags = 0;
+  while (*format != '\0' && strchr("-+ #0", *format) != nullptr) {
+    if (num_flags < sizeof(spec->flags) - 1)
+      spec->flags[num_flags++] = *format;
+    format++;
+  }
+  spec->flags[num_flags] = '\0';
+
+  spec->width = -1;
+  spec->width_star = *format == '*';
+  if (spec->width_star) {
+    format++;
+  } else if (*format >= '0' && *format <= '9') {
+    spec->width = 0;
+    while (*format >= '0' && *format <= '9')
+      spec->width = spec->width * 10 + (*format++ - '0');
+  }
+
+  spec->precision = -1;
+  spec->precision_star = false;
+  if (*format == '.') {
+    format++;
+    spec->precision_star = *format == '*';
+    if (spec->precision_star) {
+      format++;
+    } else {
+      spec->precision = 0;
+      while (*format >= '0' && *format <= '9')
+        spec->precision = spec->precision * 10 + (*format++ - '0');
+    }
+  }
+
+  spec->length = LENGTH_NONE;
+  switch (*format) {
+    case 'h':
+      format++;
+      spec->length = LENGTH_H;
+      if (*format == 'h') {
+        format++;
+        spec->length = LENGTH_HH;
+      }
+      break;
+    case 'l':
+      format++;
+      spec->length = LENGTH_L;
+      if (*format == 'l') {
+        format++;
+        spec->length = LENGTH_LL;
+      }
+      break;
+    case 'j':
+      format++;
+      spec->length = LENGTH_J;
+      break;
+    case 'z':
+      format++;
+      spec->length = LENGTH_Z;
+      break;
+    case 't':
+      format++;
+      spec->length = LENGTH_T;
+      break;
+    case 'L':
+      format++;
+      spec->length = LENGTH_BIG_L;
+      break;
+    default:
+      break;
+  }
+
+  spec->conversion = *format;
+  return *format == '\0' ? format : format + 1;
+}
+
+namespace {
+
+class RecordWriter {
+ public:
+  RecordWriter(uint8_t *out, size_t size) : out_(out), size_(size) {}
+
+  void byte(uint8_t value) {
+    if (this->out_ != nullptr && this->pos_ < this->size_)
+      this->out_[this->pos_] = value;
+    this->pos_++;
+  }
+  void varint(uint64_t value) {
+    while (value >= 0x80) {
+      this->byte(uint8_t(value) | 0x80);
+      value >>= 7;
+    }
+    this->byte(uint8_t(value));
+  }
+  void signed_varint(int64_t value) { this->varint((uint64_t(value) << 1) ^ uint64_t(value >> 63)); }
+  void string(const char *value, size_t max_length) {
+    for (size_t i = 0; i < max_length && value[i] != '\0'; i++)
+      this->byte(value[i]);
+    this->byte(0);
+  }
+  void f64(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (uint8_t i = 0; i < 8; i++, bits >>= 8)
+      this->byte(uint8_t(bits));
+  }
+  size_t size() const { return this->pos_; }
+
+ protected:
+  uint8_t *out_;
+  size_t size_;
+  size_t pos_{0};
+};
+
+class RecordReader {
+ public:
+  RecordReader(const uint8_t *data, size_t length) : data_(data), length_(length) {}
+
+  bool ok() const { return this->ok_; }
+  uint8_t byte() {
+    if (this->pos_ >= this->length_) {
+      this->ok_ = false;
+      return 0;
+    }
+    return this->data_[this->pos_++];
+  }
+  uint64_t varint() {
+    uint64_t value = 0;
+    for (uint8_t shift = 0; shift < 64 && this->ok_; shift += 7) {
+      const uint8_t b = this->byte();
+      value |= uint64_t(b & 0x7F) << shift;
+      if ((b & 0x80) == 0)
+        break;
+    }
+    return value;
+  }
+  int64_t signed_varint() {
+    const uint64_t value = this->varint();
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+  }
+  const char *string() {
+    const char *value = reinterpret_cast<const char *>(this->data_ + this->pos_);
+    while (this->ok_ && this->byte() != 0) {
+    }
+    return this->ok_ ? value : "";
+  }
+  double f64() {
+    uint64_t bits = 0;
+    for (uint8_t i = 0; i < 8; i++)
+      bits |= uint64_t(this->byte()) << (8 * i);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+ protected:
+  const uint8_t *data_;
+  size_t length_;
+  size_t pos_{0};
+  bool ok_{true};
+};
+
+}  // namespace
+
+size_t encode_binary_log(uint8_t *out, size_t size, int level, const char *tag, int line, const char *format,
+                         va_list args) {
+  RecordWriter writer(out, size);
+  const bool inline_tag = !is_in_image(tag);
+  const bool inline_format = !is_in_image(format);
+  writer.byte(BINARY_LOG_MAGIC);
+  writer.byte((level & 0x0F) | (inline_tag ? BINARY_LOG_FLAG_INLINE_TAG << 4 : 0) |
+              (inline_format ? BINARY_LOG_FLAG_INLINE_FORMAT << 4 : 0));
+  writer.varint(line);
+  if (inline_tag) {
+    writer.string(tag, BINARY_LOG_MAX_STRING);
+  } else {
+    writer.varint(reinterpret_cast<uintptr_t>(tag));
+  }
+  if (inline_format) {
+    writer.string(format, SIZE_MAX);
+  } else {
+    writer.varint(reinterpret_cast<uintptr_t>(format));
+  }
+
+  while (*format != '\0') {
+    if (*format++ != '%')
+      continue;
+    FormatSpec spec;
+    format = parse_spec(format, &spec);
+    if (spec.width_star)
+      writer.signed_varint(va_arg(args, int));
+    if (spec.precision_star) {
+      spec.precision = va_arg(args, int);
+      writer.signed_varint(spec.precision);
+    }
+
+    switch (spec.conversion) {
+      case 'd':
+      case 'i': {
+        int64_t value;
+        switch (spec.length) {
+          case LENGTH_L:
+            value = va_arg(args, long);
+            break;
+          case LENGTH_LL:
+            value = va_arg(args, long long);
+            break;
+          case LENGTH_J:
+            value = va_arg(args, intmax_t);
+            break;
+          case LENGTH_Z:
+            value = va_arg(args, ssize_t);
+            break;
+          case LENGTH_T:
+            value = va_arg(args, ptrdiff_t);
+            break;
+          case LENGTH_HH:
+            value = static_cast<signed char>(va_arg(args, int));
+            break;
+          case LENGTH_H:
+            value = static_cast<int16_t>(va_arg(args, int));
+            break;
+          default:
+            value = va_arg(args, int);
+            break;
+        }
+        writer.signed_varint(value);
+        break;
+      }
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'c': {
+        uint64_t value;
+        switch (spec.length) {
+          case LENGTH_L:
+            value = va_arg(args, unsigned long);
+            break;
+          case LENGTH_LL:
+            value = va_arg(args, unsigned long long);
+            break;
+          case LENGTH_J:
+            value = va_arg(args, uintmax_t);
+            break;
+          case LENGTH_Z:
+            value = va_arg(args, size_t);
+            break;
+          case LENGTH_T:
+            value = va_arg(args, ptrdiff_t);
+            break;
+          case LENGTH_HH:
+            value = static_cast<unsigned char>(va_arg(args, unsigned int));
+            break;
+          case LENGTH_H:
+            value = static_cast<uint16_t>(va_arg(args, unsigned int));
+            break;
+          default:
+            value = va_arg(args, unsigned int);
+            break;
+        }
+        writer.varint(value);
+        break;
+      }
+      case 'p':
+        writer.varint(reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        if (spec.length == LENGTH_BIG_L) {
+          writer.f64(double(va_arg(args, long double)));
+        } else {
+          writer.f64(va_arg(args, double));
+        }
+        break;
+      case 's': {
+        const char *value = va_arg(args, const char *);
+        size_t max_length = BINARY_LOG_MAX_STRING;
+        if (spec.precision >= 0 && size_t(spec.precision) < max_length)
+          max_length = spec.precision;
+        writer.string(value == nullptr ? "(null)" : value, max_length);
+        break;
+      }
+      case 'n':
+        va_arg(args, int *);
+        break;
+      case '%':
+        break;
+      default:
+        // Invalid conversion, the arguments after it can't be known
+        return writer.size();
+    }
+  }
+  return writer.size();
+}
+
+size_t format_binary_log(const uint8_t *record, size_t length, char *out, size_t size, int *level, const char **tag,
+                         int *line) {
+  RecordReader reader(record, length);
+  size_t at = 0;
+  auto append = [&](int written) {
+    if (written > 0)
+      at += std::min<size_t>(written, size - 1 - at);
+  };
+  out[0] = '\0';
+  *tag = nullptr;
+
+  if (reader.byte() != BINARY_LOG_MAGIC)
+    return 0;
+  const uint8_t header = reader.byte();
+  *level = header & 0x0F;
+  const uint8_t flags = header >> 4;
+  *line = reader.varint();
+  const char *record_tag =
+      (flags & BINARY_LOG_FLAG_INLINE_TAG) ? reader.string() : reinterpret_cast<const char *>(reader.varint());
+  const char *format =
+      (flags & BINARY_LOG_FLAG_INLINE_FORMAT) ? reader.string() : reinterpret_cast<const char *>(reader.varint());
+  if (!reader.ok())
+    return 0;
+  *tag = record_tag;
+
+  while (*format != '\0' && reader.ok() && at < size - 1) {
+    if (*format != '%') {
+      out[at++] = *format++;
+      continue;
+    }
+    format++;
+    FormatSpec spec;
+    format = parse_spec(format, &spec);
+    if (spec.width_star)
+      spec.width = reader.signed_varint();
+    if (spec.precision_star)
+      spec.precision = reader.signed_varint();
+
+    // Rebuild the specification with the width and precision filled in and the length of the decoded type
+    char spec_str[40];
+    int spec_len = snprintf(spec_str, sizeof(spec_str), "%%%s", spec.flags);
+    if (spec.width >= 0)
+      spec_len += snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "%d", spec.width);
+    else if (spec.width_star)  // A negative '*' width means left aligned
+      spec_len += snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "-%d", -spec.width);
+    if (spec.precision >= 0)
+      spec_len += snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, ".%d", spec.precision);
+
+    char *dest = out + at;
+    const size_t remaining = size - at;
+    switch (spec.conversion) {
+      case 'd':
+      case 'i':
+        snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "ll%c", spec.conversion);
+        append(snprintf(dest, remaining, spec_str, (long long) reader.signed_varint()));
+        break;
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X':
+        snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "ll%c", spec.conversion);
+        append(snprintf(dest, remaining, spec_str, (unsigned long long) reader.varint()));
+        break;
+      case 'c':
+        snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "c");
+        append(snprintf(dest, remaining, spec_str, int(reader.varint())));
+        break;
+      case 'p':
+        snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "p");
+        append(snprintf(dest, remaining, spec_str, reinterpret_cast<void *>(uintptr_t(reader.varint()))));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "%c", spec.conversion);
+        append(snprintf(dest, remaining, spec_str, reader.f64()));
+        break;
+      case 's':
+        snprintf(spec_str + spec_len, sizeof(spec_str) - spec_len, "s");
+        append(snprintf(dest, remaining, spec_str, reader.string()));
+        break;
+      case '%':
+        out[at++] = '%';
+        break;
+      case 'n':
+        break;
+      default:
+        format = "";
+        break;
+    }
+  }
+  out[at] = '\0';
+  return at;
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_BINARY
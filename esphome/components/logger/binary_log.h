@@ -0,0 +1,59 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_BINARY
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+/** Binary log records, which defer formatting to whoever displays the message.
+ *
+ * A record stores the level, the line, the tag and the format string, and the raw arguments the format string
+ * consumes. Tags and format strings in the firmware image are stored as their address, which the host resolves with
+ * the ELF file of the firmware; other strings are stored inline. All integers are little endian, "varint" is LEB128
+ * and signed integers are zigzag encoded first:
+ *
+ *   u8 BINARY_LOG_MAGIC
+ *   u8 level | flags << 4      (BINARY_LOG_FLAG_*)
+ *   varint line
+ *   tag                        (varint address, or null terminated if BINARY_LOG_FLAG_INLINE_TAG)
+ *   format                     (varint address, or null terminated if BINARY_LOG_FLAG_INLINE_FORMAT)
+ *   arguments, in the order of the format string:
+ *     '*' width or precision   signed varint
+ *     d i                      signed varint, truncated to the type of the length modifier
+ *     o u x X c                varint, truncated to the type of the length modifier
+ *     p                        varint
+ *     f F e E g G a A          f64
+ *     s                        null terminated, at most BINARY_LOG_MAX_STRING bytes and the precision
+ */
+static const uint8_t BINARY_LOG_MAGIC = 0xEB;
+static const uint8_t BINARY_LOG_FLAG_INLINE_TAG = 1 << 0;
+static const uint8_t BINARY_LOG_FLAG_INLINE_FORMAT = 1 << 1;
+static const size_t BINARY_LOG_MAX_STRING = 255;
+
+/** Encode a log message as a binary record.
+ *
+ * Writes at most size bytes to out and returns the size of the complete record, so that with out = nullptr it
+ * returns the size to reserve.
+ */
+size_t encode_binary_log(uint8_t *out, size_t size, int level, const char *tag, int line, const char *format,
+                         va_list args);
+
+/** Format a binary record as the same text the logger writes for the message, without the header and colors.
+ *
+ * Returns the length of the text written to out (at most size - 1 characters and the null terminator). Level, tag
+ * and line are set from the record, tag is set to nullptr if the record is invalid. Only records of this firmware
+ * can be formatted, as the tag and format string may be addresses.
+ */
+size_t format_binary_log(const uint8_t *record, size_t length, char *out, size_t size, int *level, const char **tag,
+                         int *line);
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_BINARY
@@ -0,0 +1,84 @@
+#include "log_buffer.h"
+
+#ifdef USE_LOGGER_ASYNC
+
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+static_assert(sizeof(LogRecord) <= LogBuffer::RECORD_ALIGN, "LogRecord header must fit in one alignment unit");
+
+LogBuffer::LogBuffer(size_t size) : size_(RECORD_ALIGN * 4) {
+  while (this->size_ < size)
+    this->size_ *= 2;
+  this->data_.reset(new uint8_t[this->size_]);  // NOLINT
+  memset(this->data_.get(), 0, this->size_);
+}
+
+LogRecord *LogBuffer::reserve(uint8_t level, const char *tag, size_t text_length) {
+  const size_t needed = (sizeof(LogRecord) + text_length + 1 + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+  if (needed > this->size_ / 2 || needed > UINT16_MAX) {
+    this->dropped_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  uint32_t head = this->head_.load(std::memory_order_relaxed);
+  uint32_t padding;
+  while (true) {
+    const uint32_t tail = this->tail_.load(std::memory_order_acquire);
+    // A record never wraps around the end, the space up to the end is skipped with a padding record instead
+    const uint32_t until_end = this->size_ - (head & (this->size_ - 1));
+    padding = until_end < needed ? until_end : 0;
+    if (head + padding + needed - tail > this->size_) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    if (this->head_.compare_exchange_weak(head, head + padding + needed, std::memory_order_acquire,
+                                          std::memory_order_relaxed))
+      break;
+  }
+
+  if (padding != 0) {
+    LogRecord *pad = this->at_(head);
+    pad->size = padding;
+    pad->state.store(STATE_PADDING, std::memory_order_release);
+    head += padding;
+  }
+  LogRecord *record = this->at_(head);
+  record->level = level;
+  record->size = needed;
+  record->length = text_length;
+  record->tag = tag;
+  return record;
+}
+
+LogRecord *LogBuffer::front() {
+  while (true) {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return nullptr;
+    LogRecord *record = this->at_(tail);
+    const uint8_t state = record->state.load(std::memory_order_acquire);
+    if (state == STATE_EMPTY)
+      return nullptr;  // Reserved, but not committed yet
+    if (state == STATE_COMMITTED)
+      return record;
+    this->pop(record);
+  }
+}
+
+void LogBuffer::pop(LogRecord *record) {
+  // Every record starts at a multiple of RECORD_ALIGN, so clearing the state of all of them means that records
+  // reserved in this space later always start out empty
+  const uint16_t size = record->size;
+  auto *data = reinterpret_cast<uint8_t *>(record);
+  for (uint16_t offset = 0; offset < size; offset += RECORD_ALIGN)
+    reinterpret_cast<LogRecord *>(data + offset)->state.store(STATE_EMPTY, std::memory_order_relaxed);
+  this->tail_.store(this->tail_.load(std::memory_order_relaxed) + size, std::memory_order_release);
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_ASYNC
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_ASYNC
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/** A formatted log message in the LogBuffer.
+ *
+ * Records start at a multiple of LogBuffer::RECORD_ALIGN, and the null terminated message follows the header. With
+ * USE_LOGGER_BINARY the message can also be a binary record (see binary_log.h) of length bytes, which starts with
+ * BINARY_LOG_MAGIC while text messages always start with the color or '['.
+ */
+struct LogRecord {
+  /// 0 while the message is being written, see LogBuffer.
+  std::atomic<uint8_t> state;
+  uint8_t level;
+  /// Size of the record including the header and padding.
+  uint16_t size;
+  /// Length of the message the record was reserved for, without the null terminator.
+  uint16_t length;
+  const char *tag;
+
+  char *text() { return reinterpret_cast<char *>(this) + sizeof(LogRecord); }
+  const char *text() const { return reinterpret_cast<const char *>(this) + sizeof(LogRecord); }
+};
+
+/** Lock-free ring buffer of log messages, written by any number of tasks and read by the main loop.
+ *
+ * Producers reserve space for a record by advancing the head with a compare-and-swap, format the message into it and
+ * then commit it. The consumer reads committed records in order from the tail and frees them by advancing the tail,
+ * so a slow producer only delays the records after its own. When a record doesn't fit it is dropped and counted.
+ */
+class LogBuffer {
+ public:
+  static constexpr size_t RECORD_ALIGN = 16;
+
+  /// Create a buffer of at least the given size in bytes, rounded up to a power of two.
+  explicit LogBuffer(size_t size);
+
+  /** Reserve a record for a message of text_length characters and the null terminator.
+   *
+   * Returns the record to write the message into, which must be passed to commit() afterwards, or nullptr and counts
+   * the message as dropped if the buffer is full.
+   */
+  LogRecord *reserve(uint8_t level, const char *tag, size_t text_length);
+  void commit(LogRecord *record) { record->state.store(STATE_COMMITTED, std::memory_order_release); }
+
+  /// The oldest committed record, or nullptr if there is none. Only to be called from the consumer.
+  LogRecord *front();
+  /// Free the record returned by front().
+  void pop(LogRecord *record);
+
+  /// Number of messages that were dropped since the last call.
+  uint32_t take_dropped() { return this->dropped_.exchange(0, std::memory_order_relaxed); }
+  size_t size() const { return this->size_; }
+
+ protected:
+  static constexpr uint8_t STATE_EMPTY = 0;
+  static constexpr uint8_t STATE_COMMITTED = 1;
+  /// Skip to the start of the buffer, the record didn't fit before the end.
+  static constexpr uint8_t STATE_PADDING = 2;
+
+  LogRecord *at_(uint32_t position) { return reinterpret_cast<LogRecord *>(&this->data_[position & (this->size_ - 1)]); }
+
+  size_t size_;
+  std::unique_ptr<uint8_t[]> data_;
+  /// Positions grow without wrapping, the offset in data_ is position modulo size_.
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_ASYNC
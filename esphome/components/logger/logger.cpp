@@ -23,6 +23,7 @@
 #if defined(USE_ESP32_FRAMEWORK_ARDUINO) || defined(USE_ESP_IDF)
 #include <esp_log.h>
 #endif  // USE_ESP32_FRAMEWORK_ARDUINO || USE_ESP_IDF
+#include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
@@ -64,10 +65,32 @@ void Logger::write_header_(int level, const char *tag, int line) {
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_buffer_ != nullptr) {
+    this->log_async_(level, tag, line, format, args);
+    return;
+  }
+#endif
   if (level > this->level_for(tag) || recursion_guard_)
     return;
 
   recursion_guard_ = true;
+#ifdef USE_LOGGER_BINARY
+  if (this->binary_log_callback_.size() > 0) {
+    // Encode into the text buffer, which isn't used until the callbacks returned
+    auto *record = reinterpret_cast<uint8_t *>(this->tx_buffer_);
+    va_list binary_args;
+    va_copy(binary_args, args);
+    const size_t length = encode_binary_log(record, this->tx_buffer_size_, level, tag, line, format, binary_args);
+    va_end(binary_args);
+    if (length <= static_cast<size_t>(this->tx_buffer_size_))
+      this->binary_log_callback_.call(level, record, length);
+    if (!this->has_text_outputs_()) {
+      recursion_guard_ = false;
+      return;
+    }
+  }
+#endif
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
@@ -158,17 +181,7 @@ void Logger::init_usb_serial_jtag_() {
 #endif
 #endif
 
-int HOT Logger::level_for(const char *tag) {
-  // Uses std::vector<> for low memory footprint, though the vector
-  // could be sorted to minimize lookup times. This feature isn't used that
-  // much anyway so it doesn't matter too much.
-  for (auto &it : this->log_levels_) {
-    if (it.tag == tag) {
-      return it.level;
-    }
-  }
-  return ESPHOME_LOG_LEVEL;
-}
+int HOT Logger::level_for(const char *tag) { return this->tag_levels_.level_for(tag); }
 void HOT Logger::log_message_(int level, const char *tag, int offset) {
   // remove trailing newline
   if (this->tx_buffer_[this->tx_buffer_at_ - 1] == '\n') {
@@ -177,7 +190,9 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   // make sure null terminator is present
   this->set_null_terminator_();
 
-  const char *msg = this->tx_buffer_ + offset;
+  this->write_message_(level, tag, this->tx_buffer_ + offset);
+}
+void HOT Logger::write_message_(int level, const char *tag, const char *msg) {
   if (this->baud_rate_ > 0) {
 #ifdef USE_ARDUINO
     this->hw_serial_->println(msg);
@@ -218,6 +233,171 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   this->log_callback_.call(level, tag, msg);
 }
 
+#ifdef USE_LOGGER_ASYNC
+void HOT Logger::log_async_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
+  if (level > this->level_for(tag))
+    return;
+  const bool main_task = this->is_main_task_();
+  // Like the recursion guard of the synchronous path, drop messages logged by the log callbacks
+  if (main_task && this->recursion_guard_)
+    return;
+
+  level = clamp(level, 0, 7);
+#ifdef USE_LOGGER_BINARY
+  if (this->binary_log_callback_.size() > 0) {
+    // Queue the binary record, it is formatted to text when it is written, if at all. The text outputs then get
+    // strings cut to BINARY_LOG_MAX_STRING like the binary callbacks do.
+    va_list measure_args;
+    va_copy(measure_args, args);
+    const size_t length = encode_binary_log(nullptr, 0, level, tag, line, format, measure_args);
+    va_end(measure_args);
+    // Records that would be too large for the binary log callbacks are queued as truncated text instead
+    if (length <= static_cast<size_t>(this->tx_buffer_size_)) {
+      LogRecord *record = this->reserve_async_(level, tag, length, main_task);
+      if (record == nullptr)
+        return;
+      encode_binary_log(reinterpret_cast<uint8_t *>(record->text()), length, level, tag, line, format, args);
+      this->commit_async_(record, main_task);
+      return;
+    }
+  }
+#endif
+  const char *color = LOG_LEVEL_COLORS[level];
+  const char *letter = LOG_LEVEL_LETTERS[level];
+  const size_t footer_length = strlen(ESPHOME_LOG_RESET_COLOR);
+
+  // Measure the message first, so that exactly its size is reserved and it can be formatted in place
+  va_list measure_args;
+  va_copy(measure_args, args);
+  const int header_length = snprintf(nullptr, 0, "%s[%s][%s:%03u]: ", color, letter, tag, line);
+  const int format_length = vsnprintf(nullptr, 0, format, measure_args);
+  va_end(measure_args);
+  if (header_length < 0 || format_length < 0)
+    return;
+  const size_t length =
+      std::min<size_t>(header_length + format_length + footer_length, static_cast<size_t>(this->tx_buffer_size_));
+
+  LogRecord *record = this->reserve_async_(level, tag, length, main_task);
+  if (record == nullptr)
+    return;
+
+  char *text = record->text();
+  size_t at = std::min<size_t>(snprintf(text, length + 1, "%s[%s][%s:%03u]: ", color, letter, tag, line), length);
+  if (at < length)
+    at += std::min<size_t>(vsnprintf(text + at, length + 1 - at, format, args), length - at);
+  if (at < length) {
+    memcpy(text + at, ESPHOME_LOG_RESET_COLOR, std::min(footer_length, length - at));
+    at += std::min(footer_length, length - at);
+  }
+  // remove trailing newline
+  if (at > 0 && text[at - 1] == '\n')
+    at--;
+  text[at] = '\0';
+  this->commit_async_(record, main_task);
+}
+
+void Logger::commit_async_(LogRecord *record, bool main_task) {
+  this->async_buffer_->commit(record);
+  // Write the messages of the setup right away, so that they aren't lost if it crashes
+  if (!this->async_started_) {
+    if (main_task)
+      this->process_async_buffer_();
+    return;
+  }
+#ifdef USE_TICKLESS_IDLE
+  // Also for the main task, the message may be queued after loop() of the logger already ran
+  App.wake_loop();
+#endif
+}
+
+LogRecord *Logger::reserve_async_(int level, const char *tag, size_t length, bool main_task) {
+  LogRecord *record = this->async_buffer_->reserve(level, tag, length);
+  if (record == nullptr && main_task) {
+    // Make room by writing the queued messages, messages of the main task are only dropped when that doesn't help
+    this->process_async_buffer_();
+    record = this->async_buffer_->reserve(level, tag, length);
+  }
+  return record;
+}
+
+void Logger::process_async_buffer_() {
+  if (this->recursion_guard_)
+    return;
+  this->recursion_guard_ = true;
+  while (LogRecord *record = this->async_buffer_->front()) {
+#ifdef USE_LOGGER_BINARY
+    if (static_cast<uint8_t>(record->text()[0]) == BINARY_LOG_MAGIC) {
+      this->write_binary_message_(record->level, reinterpret_cast<const uint8_t *>(record->text()), record->length);
+      this->async_buffer_->pop(record);
+      continue;
+    }
+#endif
+    this->write_message_(record->level, record->tag, record->text());
+    this->async_buffer_->pop(record);
+  }
+  this->recursion_guard_ = false;
+
+  const uint32_t dropped = this->async_buffer_->take_dropped();
+  if (dropped != 0)
+    ESP_LOGW(TAG, "%" PRIu32 " log messages were dropped, increase async_buffer_size", dropped);
+}
+
+bool Logger::is_main_task_() const {
+#ifdef USE_ESP32
+  return xTaskGetCurrentTaskHandle() == this->main_task_;
+#elif defined(USE_HOST)
+  return pthread_equal(pthread_self(), this->main_thread_);
+#else
+  return true;
+#endif
+}
+
+void Logger::set_async_buffer_size(size_t size) {
+  this->async_buffer_ = make_unique<LogBuffer>(size);
+#ifdef USE_ESP32
+  this->main_task_ = xTaskGetCurrentTaskHandle();
+#endif
+#ifdef USE_HOST
+  this->main_thread_ = pthread_self();
+#endif
+}
+void Logger::loop() {
+  if (this->async_buffer_ == nullptr)
+    return;
+  this->async_started_ = true;
+  this->process_async_buffer_();
+}
+void Logger::on_shutdown() {
+  if (this->async_buffer_ != nullptr)
+    this->process_async_buffer_();
+}
+#endif  // USE_LOGGER_ASYNC
+
+#ifdef USE_LOGGER_BINARY
+void Logger::write_binary_message_(int level, const uint8_t *record, size_t length) {
+  this->binary_log_callback_.call(level, record, length);
+  if (!this->has_text_outputs_())
+    return;
+
+  // Read the tag and line for the header first, an output of size 1 doesn't take any of the message
+  const char *tag;
+  int line;
+  char empty;
+  format_binary_log(record, length, &empty, 1, &level, &tag, &line);
+  if (tag == nullptr)
+    return;
+  this->reset_buffer_();
+  this->write_header_(level, tag, line);
+  if (!this->is_buffer_full_()) {
+    // tx_buffer_ has room for the null terminator after tx_buffer_size_
+    this->tx_buffer_at_ += format_binary_log(record, length, this->tx_buffer_ + this->tx_buffer_at_,
+                                             this->buffer_remaining_capacity_() + 1, &level, &tag, &line);
+  }
+  this->write_footer_();
+  this->log_message_(level, tag);
+}
+#endif
+
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate), tx_buffer_size_(tx_buffer_size) {
   // add 1 to buffer size for null terminator
   this->tx_buffer_ = new char[this->tx_buffer_size_ + 1];  // NOLINT
@@ -400,9 +580,7 @@ void Logger::pre_setup() {
 #endif  // USE_LIBRETINY
 
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
-void Logger::set_log_level(const std::string &tag, int log_level) {
-  this->log_levels_.push_back(LogLevelOverride{tag, log_level});
-}
+void Logger::set_log_level(const std::string &tag, int log_level) { this->tag_levels_.set_level(tag, log_level); }
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY)
 UARTSelection Logger::get_uart() const { return this->uart_; }
@@ -411,6 +589,11 @@ UARTSelection Logger::get_uart() const { return this->uart_; }
 void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
   this->log_callback_.add(std::move(callback));
 }
+#ifdef USE_LOGGER_BINARY
+void Logger::add_on_binary_log_callback(std::function<void(int, const uint8_t *, size_t)> &&callback) {
+  this->binary_log_callback_.add(std::move(callback));
+}
+#endif
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
 const char *const LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 #ifdef USE_ESP32
@@ -446,9 +629,13 @@ void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
 #endif
 
-  for (auto &it : this->log_levels_) {
+  for (const auto &it : this->tag_levels_.get_overrides()) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_buffer_ != nullptr)
+    ESP_LOGCONFIG(TAG, "  Async Buffer Size: %zu bytes", this->async_buffer_->size());
+#endif
 }
 void Logger::write_footer_() { this->write_to_buffer_(ESPHOME_LOG_RESET_COLOR, strlen(ESPHOME_LOG_RESET_COLOR)); }
 
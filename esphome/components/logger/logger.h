@@ -6,6 +6,23 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
+#include "tag_levels.h"
+
+#ifdef USE_LOGGER_BINARY
+#include "binary_log.h"
+#endif
+
+#ifdef USE_LOGGER_ASYNC
+#include "log_buffer.h"
+#include <memory>
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+#ifdef USE_HOST
+#include <pthread.h>
+#endif
+#endif
 
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
@@ -83,9 +100,28 @@ class Logger : public Component {
   UARTSelection get_uart() const;
 #endif
 
-  /// Set the log level of the specified tag.
+  /** Set the log level of the specified tag.
+   *
+   * Can also be called at runtime from the main loop, but messages above the global log level are compiled out.
+   */
   void set_log_level(const std::string &tag, int log_level);
 
+#ifdef USE_LOGGER_ASYNC
+  /** Queue log messages in a buffer of the given size and write them from loop().
+   *
+   * Logging then only formats the message, and messages from other tasks aren't dropped while the main task is
+   * logging. While binary log callbacks are registered, messages are queued as binary records and only formatted to
+   * text when they are written, so the serial output then also cuts %s arguments to BINARY_LOG_MAX_STRING bytes.
+   */
+  void set_async_buffer_size(size_t size);
+  void loop() override;
+  void on_shutdown() override;
+#ifdef USE_TICKLESS_IDLE
+  /// Messages of other tasks wake the loop, those of the main task are written before it idles.
+  bool can_idle() override { return true; }
+#endif
+#endif
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
@@ -96,6 +132,13 @@ class Logger : public Component {
 
   /// Register a callback that will be called for every log message sent
   void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+#ifdef USE_LOGGER_BINARY
+  /** Register a callback that will be called with the binary record (see binary_log.h) of every log message.
+   *
+   * Messages are then only formatted to text if the serial port or a text log callback needs them.
+   */
+  void add_on_binary_log_callback(std::function<void(int, const uint8_t *, size_t)> &&callback);
+#endif
 
   float get_setup_priority() const override;
 
@@ -118,6 +161,29 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  /// Write a complete message to the serial port and the log callbacks.
+  void write_message_(int level, const char *tag, const char *msg);
+#ifdef USE_LOGGER_ASYNC
+  void log_async_(int level, const char *tag, int line, const char *format, va_list args);
+  /// Write all queued messages.
+  void process_async_buffer_();
+  bool is_main_task_() const;
+  /// Reserve a record in the async buffer, writing the queued messages to make room if called from the main task.
+  LogRecord *reserve_async_(int level, const char *tag, size_t length, bool main_task);
+  /// Queue a reserved record, and make sure it is written soon.
+  void commit_async_(LogRecord *record, bool main_task);
+#endif
+#ifdef USE_LOGGER_BINARY
+  /// Send a binary record to the binary log callbacks, and format it for the text outputs.
+  void write_binary_message_(int level, const uint8_t *record, size_t length);
+  bool has_text_outputs_() const {
+#ifdef USE_HOST
+    return true;
+#else
+    return this->baud_rate_ > 0 || this->log_callback_.size() > 0;
+#endif
+  }
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -173,14 +239,24 @@ class Logger : public Component {
 #ifdef USE_ESP_IDF
   uart_port_t uart_num_;
 #endif
-  struct LogLevelOverride {
-    std::string tag;
-    int level;
-  };
-  std::vector<LogLevelOverride> log_levels_;
+  TagLevels tag_levels_;
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+#ifdef USE_LOGGER_BINARY
+  CallbackManager<void(int, const uint8_t *, size_t)> binary_log_callback_{};
+#endif
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
+#ifdef USE_LOGGER_ASYNC
+  std::unique_ptr<LogBuffer> async_buffer_;
+  /// Whether loop() writes the queued messages, until then messages of the main task are written right away.
+  bool async_started_{false};
+#ifdef USE_ESP32
+  TaskHandle_t main_task_{nullptr};
+#endif
+#ifdef USE_HOST
+  pthread_t main_thread_{};
+#endif
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -200,6 +276,14 @@ class LoggerMessageTrigger : public Trigger<int, const char *, const char *> {
   int level_;
 };
 
+template<typename... Ts> class SetLogLevelAction : public Action<Ts...>, public Parented<Logger> {
+ public:
+  TEMPLATABLE_VALUE(std::string, tag)
+  TEMPLATABLE_VALUE(int, level)
+
+  void play(Ts... x) override { this->parent_->set_log_level(this->tag_.value(x...), this->level_.value(x...)); }
+};
+
 }  // namespace logger
 
 }  // namespace esphome
@@ -0,0 +1,91 @@
+#include "tag_levels.h"
+#include "esphome/core/log.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+static_assert((TagLevels::CACHE_SIZE & (TagLevels::CACHE_SIZE - 1)) == 0, "CACHE_SIZE must be a power of two");
+
+/// Number of slots after the hash of a tag that are searched for it.
+static const size_t MAX_PROBES = 8;
+
+static inline size_t next_slot(size_t index) { return (index + 1) & (TagLevels::CACHE_SIZE - 1); }
+
+int HOT TagLevels::level_for(const char *tag) {
+  CacheSlot *cache = this->cache_.load(std::memory_order_acquire);
+  if (cache == nullptr)
+    return ESPHOME_LOG_LEVEL;
+
+  // Fibonacci hashing of the address, the low bits of string addresses are poorly distributed
+  const uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tag)) * 2654435769u;
+  const size_t start = hash >> (32 - __builtin_ctz(CACHE_SIZE));
+  size_t index = start;
+  for (size_t probe = 0; probe < MAX_PROBES; probe++, index = next_slot(index)) {
+    CacheSlot &slot = cache[index];
+    const char *slot_tag = slot.tag.load(std::memory_order_acquire);
+    if (slot_tag == tag)
+      return slot.level.load(std::memory_order_relaxed);
+    if (slot_tag == nullptr)
+      return this->cache_level_(tag, start);
+  }
+
+  LockGuard guard{this->lock_};
+  return this->find_level_(tag);
+}
+
+int TagLevels::cache_level_(const char *tag, size_t index) {
+  LockGuard guard{this->lock_};
+  CacheSlot *cache = this->cache_.load(std::memory_order_relaxed);
+  const int level = this->find_level_(tag);
+  // Other tasks may have filled slots since they were searched without the lock
+  for (size_t probe = 0; probe < MAX_PROBES; probe++, index = next_slot(index)) {
+    CacheSlot &slot = cache[index];
+    const char *slot_tag = slot.tag.load(std::memory_order_relaxed);
+    if (slot_tag == tag)
+      return level;
+    if (slot_tag == nullptr) {
+      slot.level.store(level, std::memory_order_relaxed);
+      slot.tag.store(tag, std::memory_order_release);
+      return level;
+    }
+  }
+  return level;
+}
+
+void TagLevels::set_level(const std::string &tag, int level) {
+  LockGuard guard{this->lock_};
+  bool found = false;
+  for (auto &it : this->overrides_) {
+    if (it.tag == tag) {
+      it.level = level;
+      found = true;
+    }
+  }
+  if (!found)
+    this->overrides_.push_back(Override{tag, level});
+
+  CacheSlot *cache = this->cache_.load(std::memory_order_relaxed);
+  if (cache == nullptr) {
+    this->cache_.store(new CacheSlot[CACHE_SIZE], std::memory_order_release);  // NOLINT
+    return;
+  }
+  // Tags that were cached before have the global level, or the one that was set before
+  for (size_t i = 0; i < CACHE_SIZE; i++) {
+    const char *slot_tag = cache[i].tag.load(std::memory_order_relaxed);
+    if (slot_tag != nullptr && tag == slot_tag)
+      cache[i].level.store(level, std::memory_order_relaxed);
+  }
+}
+
+int TagLevels::find_level_(const char *tag) const {
+  for (const auto &it : this->overrides_) {
+    if (it.tag == tag)
+      return it.level;
+  }
+  return ESPHOME_LOG_LEVEL;
+}
+
+}  // namespace logger
+}  // namespace esphome
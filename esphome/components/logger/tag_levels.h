@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace logger {
+
+/** The log levels set for specific tags, with a cache from the tag pointer to its level.
+ *
+ * Tags are almost always the TAG constant of a file, so the level of a tag is looked up by comparing strings only the
+ * first time it logs, and after that with the address of the string in a small hash table. The table is only used
+ * once a level was set for a tag, before that every tag has the global level.
+ *
+ * level_for() may be called from any task, set_level() and get_overrides() only from the main loop. Cache hits don't
+ * lock, cache misses and set_level() hold a mutex so that a tag is never cached with a level that was just replaced.
+ */
+class TagLevels {
+ public:
+  /// Number of tags that can be cached, tags after that are looked up by comparing strings.
+  static constexpr size_t CACHE_SIZE = 64;
+
+  struct Override {
+    std::string tag;
+    int level;
+  };
+
+  /// The log level of the tag, ESPHOME_LOG_LEVEL if none was set for it.
+  int level_for(const char *tag);
+  /// Set the log level of the tag, replacing the level set before.
+  void set_level(const std::string &tag, int level);
+
+  const std::vector<Override> &get_overrides() const { return this->overrides_; }
+
+ protected:
+  struct CacheSlot {
+    /// The tag pointer, nullptr while the slot is empty. Only written with lock_ held, after the level.
+    std::atomic<const char *> tag{nullptr};
+    std::atomic<int8_t> level{0};
+  };
+
+  /// Look up the level of a tag that isn't cached and add it to the cache.
+  int cache_level_(const char *tag, size_t index);
+  /// The level set for the tag, lock_ must be held.
+  int find_level_(const char *tag) const;
+
+  Mutex lock_;
+  std::vector<Override> overrides_;
+  std::atomic<CacheSlot *> cache_{nullptr};
+};
+
+}  // namespace logger
+}  // namespace esphome
@@ -18,7 +18,9 @@ from esphome.const import (
     CONF_DISCOVERY_RETAIN,
     CONF_DISCOVERY_UNIQUE_ID_GENERATOR,
     CONF_DISCOVERY_OBJECT_ID_GENERATOR,
+    CONF_FORMAT,
     CONF_ID,
+    CONF_INTERVAL,
     CONF_KEEPALIVE,
     CONF_LEVEL,
     CONF_LOG_TOPIC,
@@ -56,6 +58,13 @@ AUTO_LOAD = ["json"]
 
 CONF_IDF_SEND_ASYNC = "idf_send_async"
 CONF_SKIP_CERT_CN_CHECK = "skip_cert_cn_check"
+CONF_PUBLISH_QUEUE = "publish_queue"
+CONF_MAX_SIZE = "max_size"
+CONF_MAX_INFLIGHT = "max_inflight"
+
+LOG_FORMAT_TEXT = "TEXT"
+LOG_FORMAT_BINARY = "BINARY"
+LOG_FORMATS = [LOG_FORMAT_TEXT, LOG_FORMAT_BINARY]
 
 
 def validate_message_just_topic(value):
@@ -225,6 +234,9 @@ CONFIG_SCHEMA = cv.All(
                 MQTT_MESSAGE_BASE.extend(
                     {
                         cv.Optional(CONF_LEVEL): logger.is_log_level,
+                        cv.Optional(CONF_FORMAT): cv.All(
+                            cv.one_of(*LOG_FORMATS, upper=True), cv.only_on_esp32
+                        ),
                     }
                 ),
                 validate_message_just_topic,
@@ -236,6 +248,19 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_PUBLISH_QUEUE): cv.Schema(
+                {
+                    cv.Optional(CONF_MAX_SIZE, default=32): cv.int_range(
+                        min=1, max=1024
+                    ),
+                    cv.Optional(
+                        CONF_INTERVAL, default="10ms"
+                    ): cv.positive_time_period_milliseconds,
+                    cv.Optional(CONF_MAX_INFLIGHT, default=4): cv.int_range(
+                        min=0, max=255
+                    ),
+                }
+            ),
             cv.Optional(CONF_ON_CONNECT): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(MQTTConnectTrigger),
@@ -361,6 +386,9 @@ async def to_code(config):
 
         if CONF_LEVEL in log_topic:
             cg.add(var.set_log_level(logger.LOG_LEVELS[log_topic[CONF_LEVEL]]))
+        if log_topic.get(CONF_FORMAT) == LOG_FORMAT_BINARY:
+            cg.add_define("USE_LOGGER_BINARY")
+            cg.add(var.set_binary_log(True))
 
     if CONF_SSL_FINGERPRINTS in config:
         for fingerprint in config[CONF_SSL_FINGERPRINTS]:
@@ -374,6 +402,16 @@ async def to_code(config):
 
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
 
+    if CONF_PUBLISH_QUEUE in config:
+        publish_queue = config[CONF_PUBLISH_QUEUE]
+        cg.add(
+            var.set_publish_queue(
+                publish_queue[CONF_MAX_SIZE],
+                publish_queue[CONF_INTERVAL],
+                publish_queue[CONF_MAX_INFLIGHT],
+            )
+        )
+
     # esp-idf only
     if CONF_CERTIFICATE_AUTHORITY in config:
         cg.add(var.set_ca_certificate(config[CONF_CERTIFICATE_AUTHORITY]))
@@ -2,6 +2,7 @@
 
 #ifdef USE_MQTT
 
+#include <algorithm>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -27,6 +28,17 @@ namespace mqtt {
 
 static const char *const TAG = "mqtt";
 
+#ifdef USE_ESP8266
+/// A received message, dispatched from the main loop.
+struct DeferredMessage {
+  MQTTClientComponent *client;
+  std::string topic;
+  std::string payload;
+
+  void operator()() const { this->client->dispatch_message_(this->topic, this->payload); }
+};
+#endif
+
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
   this->credentials_.client_id = App.get_name() + "-" + get_mac_address();
@@ -45,16 +57,41 @@ void MQTTClientComponent::setup() {
 
         // MQTT fully received
         if (len + index == total) {
+#ifdef USE_ESP8266
+          // Like on_message(), but the payload is moved to the deferred call instead of copied
+          this->defer(DeferredMessage{this, topic, std::move(this->payload_buffer_)});
+#else
           this->on_message(topic, this->payload_buffer_);
+#endif
           this->payload_buffer_.clear();
         }
       });
+  if (this->publish_queue_size_ != 0) {
+    this->mqtt_backend_.set_on_publish([this](uint16_t packet_id) {
+      // Also called for messages that bypassed the queue, so don't underflow
+      if (this->inflight_ > 0)
+        this->inflight_--;
+    });
+  }
   this->mqtt_backend_.set_on_disconnect([this](MQTTClientDisconnectReason reason) {
     this->state_ = MQTT_CLIENT_DISCONNECTED;
     this->disconnect_reason_ = reason;
   });
 #ifdef USE_LOGGER
-  if (this->is_log_message_enabled() && logger::global_logger != nullptr) {
+#ifdef USE_LOGGER_BINARY
+  if (this->is_log_message_enabled() && logger::global_logger != nullptr && this->binary_log_) {
+    logger::global_logger->add_on_binary_log_callback([this](int level, const uint8_t *record, size_t length) {
+      if (level <= this->log_level_ && this->is_connected()) {
+        this->publish(this->log_message_.topic, reinterpret_cast<const char *>(record), length, this->log_message_.qos,
+                      this->log_message_.retain);
+      }
+    });
+  }
+  const bool text_log = !this->binary_log_;
+#else
+  const bool text_log = true;
+#endif
+  if (text_log && this->is_log_message_enabled() && logger::global_logger != nullptr) {
     logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
       if (level <= this->log_level_ && this->is_connected()) {
         this->publish({.topic = this->log_message_.topic,
@@ -142,10 +179,18 @@ void MQTTClientComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  Topic Prefix: '%s'", this->topic_prefix_.c_str());
   if (!this->log_message_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Log Topic: '%s'", this->log_message_.topic.c_str());
+#ifdef USE_LOGGER_BINARY
+    if (this->binary_log_)
+      ESP_LOGCONFIG(TAG, "  Log Format: binary");
+#endif
   }
   if (!this->availability_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Availability: '%s'", this->availability_.topic.c_str());
   }
+  if (this->publish_queue_size_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Publish Queue: %u messages, %ums interval, %u in flight", this->publish_queue_size_,
+                  this->publish_interval_, this->max_inflight_);
+  }
 }
 bool MQTTClientComponent::can_proceed() { return network::is_disabled() || this->is_connected(); }
 
@@ -270,6 +315,8 @@ void MQTTClientComponent::check_connected() {
 
   this->state_ = MQTT_CLIENT_CONNECTED;
   this->sent_birth_message_ = false;
+  // Acknowledgements of the old connection won't arrive anymore
+  this->inflight_ = 0;
   this->status_clear_warning();
   ESP_LOGI(TAG, "MQTT Connected!");
   // MQTT Client needs some time to be fully set up.
@@ -350,6 +397,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->process_publish_queue_(now);
       }
       break;
   }
@@ -396,31 +444,34 @@ void MQTTClientComponent::resubscribe_subscriptions_() {
   }
 }
 
+void MQTTClientComponent::add_subscription_(MQTTSubscription &&subscription) {
+  this->resubscribe_subscription_(&subscription);
+  subscription.id = this->next_subscription_id_++;
+  this->subscription_trie_.insert(subscription.topic, subscription.id);
+  this->subscriptions_.push_back(std::move(subscription));
+}
+
 void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t callback, uint8_t qos) {
-  MQTTSubscription subscription{
+  this->add_subscription_(MQTTSubscription{
       .topic = topic,
       .qos = qos,
       .callback = std::move(callback),
       .subscribed = false,
       .resubscribe_timeout = 0,
-  };
-  this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  });
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
   auto f = [callback](const std::string &topic, const std::string &payload) {
     json::parse_json(payload, [topic, callback](JsonObject root) { callback(topic, root); });
   };
-  MQTTSubscription subscription{
+  this->add_subscription_(MQTTSubscription{
       .topic = topic,
       .qos = qos,
       .callback = f,
       .subscribed = false,
       .resubscribe_timeout = 0,
-  };
-  this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  });
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -442,6 +493,9 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
       ++it;
     }
   }
+  this->subscription_trie_.clear();
+  for (auto &subscription : this->subscriptions_)
+    this->subscription_trie_.insert(subscription.topic, subscription.id);
 }
 
 // Publish
@@ -451,7 +505,7 @@ bool MQTTClientComponent::publish(const std::string &topic, const std::string &p
 
 bool MQTTClientComponent::publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos,
                                   bool retain) {
-  return publish({.topic = topic, .payload = payload, .qos = qos, .retain = retain});
+  return publish({.topic = topic, .payload = std::string(payload, payload_length), .qos = qos, .retain = retain});
 }
 
 bool MQTTClientComponent::publish(const MQTTMessage &message) {
@@ -459,6 +513,13 @@ bool MQTTClientComponent::publish(const MQTTMessage &message) {
     // critical components will re-transmit their messages
     return false;
   }
+  if (this->publish_queue_size_ != 0 && this->log_message_.topic != message.topic)
+    return this->enqueue_publish_(message);
+  return this->publish_now_(message);
+}
+bool MQTTClientComponent::publish_now_(const MQTTMessage &message) {
+  if (!this->is_connected())
+    return false;
   bool logging_topic = this->log_message_.topic == message.topic;
   bool ret = this->mqtt_backend_.publish(message);
   delay(0);
@@ -480,84 +541,79 @@ bool MQTTClientComponent::publish(const MQTTMessage &message) {
   }
   return ret != 0;
 }
-bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
-                                       bool retain) {
-  std::string message = json::build_json(f);
-  return this->publish(topic, message, qos, retain);
-}
-
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
+bool MQTTClientComponent::enqueue_publish_(const MQTTMessage &message) {
+  if (message.retain) {
+    // Only the newest queued message for the topic may be replaced, so that the order of messages is kept
+    for (auto it = this->publish_queue_.rbegin(); it != this->publish_queue_.rend(); ++it) {
+      if (it->topic != message.topic)
+        continue;
+      if (!it->retain)
+        break;
+      ESP_LOGVV(TAG, "Replacing queued message for topic='%s'", message.topic.c_str());
+      it->payload = message.payload;
+      it->qos = message.qos;
+      return true;
     }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
   }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
+  if (this->publish_queue_.size() >= this->publish_queue_size_) {
+    ESP_LOGV(TAG, "Publish queue full, dropping message for topic='%s'", message.topic.c_str());
+    this->status_momentary_warning("publish", 1000);
     return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
+  }
+  this->publish_queue_.push_back(message);
+  return true;
+}
+void MQTTClientComponent::process_publish_queue_(uint32_t now) {
+  // Without an interval, send until the backend or the in-flight limit stops us
+  while (!this->publish_queue_.empty() && now - this->last_queue_publish_ >= this->publish_interval_) {
+    const MQTTMessage &message = this->publish_queue_.front();
+    if (message.qos > 0 && this->max_inflight_ != 0 && this->inflight_ >= this->max_inflight_)
+      return;
+    // Keep the message queued if the backend can't take it right now
+    if (!this->publish_now_(message))
+      return;
+    if (message.qos > 0 && this->inflight_ < 255)
+      this->inflight_++;
+    this->publish_queue_.pop_front();
+    this->last_queue_publish_ = now;
+    if (this->publish_interval_ != 0)
+      return;
+  }
 }
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
+bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
+                                       bool retain) {
+  std::string message = json::build_json(f);
+  return this->publish(topic, message, qos, retain);
 }
 
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
 #ifdef USE_ESP8266
   // on ESP8266, this is called in lwIP/AsyncTCP task; some components do not like running
   // from a different task.
-  this->defer([this, topic, payload]() {
-#endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
-    }
-#ifdef USE_ESP8266
-  });
+  this->defer(DeferredMessage{this, topic, payload});
+#else
+  this->dispatch_message_(topic, payload);
 #endif
 }
 
+void MQTTClientComponent::dispatch_message_(const std::string &topic, const std::string &payload) {
+  // Take the buffer for the ids, so that it is reused and a callback calling on_message() gets its own
+  std::vector<uint32_t> matches;
+  matches.swap(this->subscription_matches_);
+  matches.clear();
+  this->subscription_trie_.match(topic, matches);
+  if (matches.size() > 1)
+    std::sort(matches.begin(), matches.end());
+  for (uint32_t id : matches) {
+    // Look every id up again, callbacks can subscribe and unsubscribe, which moves the subscriptions
+    auto it = std::lower_bound(this->subscriptions_.begin(), this->subscriptions_.end(), id,
+                               [](const MQTTSubscription &subscription, uint32_t id) { return subscription.id < id; });
+    if (it != this->subscriptions_.end() && it->id == id)
+      it->callback(topic, payload);
+  }
+  this->subscription_matches_.swap(matches);
+}
+
 // Setters
 void MQTTClientComponent::disable_log_message() { this->log_message_.topic = ""; }
 bool MQTTClientComponent::is_log_message_enabled() const { return !this->log_message_.topic.empty(); }
@@ -625,7 +681,7 @@ void MQTTClientComponent::disable_discovery() {
 void MQTTClientComponent::on_shutdown() {
   if (!this->shutdown_message_.topic.empty()) {
     yield();
-    this->publish(this->shutdown_message_);
+    this->publish_now_(this->shutdown_message_);
     yield();
   }
   this->mqtt_backend_.disconnect();
@@ -17,7 +17,9 @@
 #include "mqtt_backend_libretiny.h"
 #endif
 #include "lwip/ip_addr.h"
+#include "mqtt_topic_trie.h"
 
+#include <deque>
 #include <vector>
 
 namespace esphome {
@@ -42,6 +44,8 @@ struct MQTTSubscription {
   mqtt_callback_t callback;
   bool subscribed;
   uint32_t resubscribe_timeout;
+  /// Set when subscribing, never reused, so that it stays valid when other subscriptions are removed.
+  uint32_t id;
 };
 
 /// internal struct for MQTT credentials.
@@ -165,6 +169,10 @@ class MQTTClientComponent : public Component {
   /// Manually set the topic used for logging.
   void set_log_message_template(MQTTMessage &&message);
   void set_log_level(int level);
+#ifdef USE_LOGGER_BINARY
+  /// Publish binary log records instead of text, see logger/binary_log.h.
+  void set_binary_log(bool binary_log) { this->binary_log_ = binary_log; }
+#endif
   /// Get the topic used for logging. Defaults to "<topic_prefix>/debug" and the value is cached for speed.
   void disable_log_message();
   bool is_log_message_enabled() const;
@@ -238,6 +246,23 @@ class MQTTClientComponent : public Component {
 
   void set_reboot_timeout(uint32_t reboot_timeout);
 
+  /** Queue outgoing messages instead of handing them to the backend right away.
+   *
+   * A queued retained message is replaced by a newer retained message for the same topic, so that a burst of
+   * state updates (e.g. after reconnecting) only sends the last state of every topic. Messages for the log topic
+   * are never queued.
+   *
+   * @param max_size The maximum number of queued messages, publishing fails if the queue is full. 0 disables it.
+   * @param interval The minimum time between two messages sent from the queue in ms.
+   * @param max_inflight The maximum number of QoS 1/2 messages that aren't acknowledged by the broker. 0 means
+   * unlimited.
+   */
+  void set_publish_queue(uint16_t max_size, uint32_t interval, uint8_t max_inflight) {
+    this->publish_queue_size_ = max_size;
+    this->publish_interval_ = interval;
+    this->max_inflight_ = max_inflight;
+  }
+
   void register_mqtt_component(MQTTComponent *component);
 
   bool is_connected();
@@ -271,6 +296,18 @@ class MQTTClientComponent : public Component {
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
+  void add_subscription_(MQTTSubscription &&subscription);
+  /// Hand the message to the backend, bypassing the publish queue.
+  bool publish_now_(const MQTTMessage &message);
+  /// Add the message to the publish queue, replacing a queued retained message for the same topic.
+  bool enqueue_publish_(const MQTTMessage &message);
+  /// Send the next message of the publish queue, if the send interval and the in-flight limit allow it.
+  void process_publish_queue_(uint32_t now);
+  /// Call the callbacks of all subscriptions matching the topic, in the order they subscribed.
+  void dispatch_message_(const std::string &topic, const std::string &payload);
+#ifdef USE_ESP8266
+  friend struct DeferredMessage;
+#endif
 
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
@@ -296,8 +333,23 @@ class MQTTClientComponent : public Component {
   MQTTMessage log_message_;
   std::string payload_buffer_;
   int log_level_{ESPHOME_LOG_LEVEL};
+#ifdef USE_LOGGER_BINARY
+  bool binary_log_{false};
+#endif
 
+  /// Sorted by id, as ids only increase.
   std::vector<MQTTSubscription> subscriptions_;
+  /// The topics of subscriptions_, with the id of the subscription.
+  MQTTTopicTrie subscription_trie_;
+  uint32_t next_subscription_id_{0};
+  std::vector<uint32_t> subscription_matches_;
+  std::deque<MQTTMessage> publish_queue_;
+  uint16_t publish_queue_size_{0};
+  uint32_t publish_interval_{0};
+  uint32_t last_queue_publish_{0};
+  uint8_t max_inflight_{0};
+  /// Number of QoS 1/2 messages sent from the queue that weren't acknowledged yet.
+  uint8_t inflight_{0};
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
@@ -0,0 +1,96 @@
+#include "mqtt_topic_trie.h"
+#include "esphome/core/helpers.h"
+
+#ifdef USE_MQTT
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+void MQTTTopicTrie::insert(const std::string &filter, uint32_t id) {
+  Node *node = &this->root_;
+  size_t start = 0;
+  while (true) {
+    size_t end = filter.find('/', start);
+    if (end == std::string::npos)
+      end = filter.size();
+    const size_t length = end - start;
+
+    if (length == 1 && filter[start] == '#') {
+      // MQTT mandates that '#' is the last level
+      node->multi_level.push_back(id);
+      return;
+    }
+    if (length == 1 && filter[start] == '+') {
+      if (node->single_level == nullptr)
+        node->single_level = make_unique<Node>();
+      node = node->single_level.get();
+    } else {
+      std::string level = filter.substr(start, length);
+      auto it = std::lower_bound(
+          node->children.begin(), node->children.end(), level,
+          [](const std::unique_ptr<Node> &child, const std::string &level) { return child->level < level; });
+      if (it == node->children.end() || (*it)->level != level) {
+        auto child = make_unique<Node>();
+        child->level = std::move(level);
+        it = node->children.insert(it, std::move(child));
+      }
+      node = it->get();
+    }
+
+    if (end == filter.size())
+      break;
+    start = end + 1;
+  }
+  node->exact.push_back(id);
+}
+
+void MQTTTopicTrie::clear() { this->root_ = Node(); }
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<uint32_t> &matches) const {
+  // Wildcards in the first level don't match topics like "$SYS/..."
+  const bool wildcards = topic.empty() || topic[0] != '$';
+  this->match_(this->root_, topic.data(), topic.data() + topic.size(), wildcards, matches);
+}
+
+void MQTTTopicTrie::match_(const Node &node, const char *level, const char *end, bool wildcards,
+                           std::vector<uint32_t> &matches) const {
+  if (wildcards)
+    matches.insert(matches.end(), node.multi_level.begin(), node.multi_level.end());
+  if (level == nullptr) {
+    // All levels of the topic are consumed
+    matches.insert(matches.end(), node.exact.begin(), node.exact.end());
+    return;
+  }
+
+  const char *level_end = static_cast<const char *>(memchr(level, '/', end - level));
+  if (level_end == nullptr)
+    level_end = end;
+  const char *next = level_end == end ? nullptr : level_end + 1;
+  const size_t length = level_end - level;
+
+  // Binary search for the child with this level, without copying it to a string
+  size_t lo = 0, hi = node.children.size();
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    const int cmp = node.children[mid]->level.compare(0, std::string::npos, level, length);
+    if (cmp == 0) {
+      this->match_(*node.children[mid], next, end, true, matches);
+      break;
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (wildcards && node.single_level != nullptr)
+    this->match_(*node.single_level, next, end, true, matches);
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** A tree of subscription topic filters, split at the '/' separators, to find the filters matching a topic.
+ *
+ * Matching walks the levels of the topic once, following the child with the same name and the '+' child of every
+ * node, so it doesn't depend on the number of filters. Like the MQTT spec mandates, '#' also matches the parent level
+ * and wildcards in the first level don't match topics starting with '$'.
+ */
+class MQTTTopicTrie {
+ public:
+  /// Add a topic filter, matches are reported with the given id.
+  void insert(const std::string &filter, uint32_t id);
+  void clear();
+  /// Append the ids of all filters matching the topic to matches, in no particular order.
+  void match(const std::string &topic, std::vector<uint32_t> &matches) const;
+
+ protected:
+  struct Node {
+    std::string level;
+    /// Children for regular levels, sorted by level.
+    std::vector<std::unique_ptr<Node>> children;
+    /// Child for the '+' wildcard.
+    std::unique_ptr<Node> single_level;
+    /// Filters that end at this node.
+    std::vector<uint32_t> exact;
+    /// Filters that continue with '#' after this node.
+    std::vector<uint32_t> multi_level;
+  };
+
+  void match_(const Node &node, const char *level, const char *end, bool wildcards,
+              std::vector<uint32_t> &matches) const;
+
+  Node root_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -121,6 +121,16 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                nullptr, this->effect_data_ + index, &this->correction_);
   }
+  light::ESPPixelBuffer get_pixel_buffer_internal() const override {  // NOLINT
+    light::ESPPixelBuffer buffer;
+    buffer.pixels = this->controller_->Pixels();
+    buffer.effect_data = this->effect_data_;
+    buffer.stride = 3;
+    buffer.channels = 3;
+    for (uint8_t i = 0; i < 3; i++)
+      buffer.offsets[i] = this->rgb_offsets_[i];
+    return buffer;
+  }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -138,6 +148,16 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
   }
+  light::ESPPixelBuffer get_pixel_buffer_internal() const override {  // NOLINT
+    light::ESPPixelBuffer buffer;
+    buffer.pixels = this->controller_->Pixels();
+    buffer.effect_data = this->effect_data_;
+    buffer.stride = 4;
+    buffer.channels = 4;
+    for (uint8_t i = 0; i < 4; i++)
+      buffer.offsets[i] = this->rgb_offsets_[i];
+    return buffer;
+  }
 };
 
 }  // namespace neopixelbus
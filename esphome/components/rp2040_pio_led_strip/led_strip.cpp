@@ -80,45 +80,54 @@ void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
   }
 }
 
-light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0, w = 0;
+light::ESPPixelBuffer RP2040PIOLEDStripLightOutput::get_pixel_buffer_internal() const {
+  light::ESPPixelBuffer buffer;
+  buffer.pixels = this->buf_;
+  buffer.effect_data = this->effect_data_;
+  buffer.stride = this->is_rgbw_ ? 4 : 3;
+  buffer.channels = buffer.stride;
   switch (this->rgb_order_) {
     case ORDER_RGB:
-      r = 0;
-      g = 1;
-      b = 2;
+      buffer.offsets[0] = 0;
+      buffer.offsets[1] = 1;
+      buffer.offsets[2] = 2;
       break;
     case ORDER_RBG:
-      r = 0;
-      g = 2;
-      b = 1;
+      buffer.offsets[0] = 0;
+      buffer.offsets[1] = 2;
+      buffer.offsets[2] = 1;
       break;
     case ORDER_GRB:
-      r = 1;
-      g = 0;
-      b = 2;
+      buffer.offsets[0] = 1;
+      buffer.offsets[1] = 0;
+      buffer.offsets[2] = 2;
       break;
     case ORDER_GBR:
-      r = 2;
-      g = 0;
-      b = 1;
+      buffer.offsets[0] = 2;
+      buffer.offsets[1] = 0;
+      buffer.offsets[2] = 1;
       break;
     case ORDER_BGR:
-      r = 2;
-      g = 1;
-      b = 0;
+      buffer.offsets[0] = 2;
+      buffer.offsets[1] = 1;
+      buffer.offsets[2] = 0;
       break;
     case ORDER_BRG:
-      r = 1;
-      g = 2;
-      b = 0;
+      buffer.offsets[0] = 1;
+      buffer.offsets[1] = 2;
+      buffer.offsets[2] = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ ? 4 : 3;
-  return {this->buf_ + (index * multiplier) + r,
-          this->buf_ + (index * multiplier) + g,
-          this->buf_ + (index * multiplier) + b,
-          this->is_rgbw_ ? this->buf_ + (index * multiplier) + 3 : nullptr,
+  return buffer;
+}
+
+light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t index) const {
+  const light::ESPPixelBuffer buffer = this->get_pixel_buffer_internal();
+  uint8_t *base = buffer.pixels + index * buffer.stride;
+  return {base + buffer.offsets[0],
+          base + buffer.offsets[1],
+          base + buffer.offsets[2],
+          this->is_rgbw_ ? base + buffer.offsets[3] : nullptr,
           &this->effect_data_[index],
           &this->correction_};
 }
@@ -0,0 +1,50 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_COMPONENTS,
+    CONF_DURATION,
+    CONF_ID,
+    PLATFORM_HOST,
+)
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["logger"]
+
+CONF_TIMEOUTS = "timeouts"
+CONF_INTERVALS = "intervals"
+CONF_STORM_INTERVAL = "storm_interval"
+
+scheduler_benchmark_ns = cg.esphome_ns.namespace("scheduler_benchmark")
+SchedulerBenchmark = scheduler_benchmark_ns.class_(
+    "SchedulerBenchmark", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(SchedulerBenchmark),
+            cv.Optional(CONF_COMPONENTS, default=100): cv.int_range(min=1, max=10000),
+            cv.Optional(CONF_TIMEOUTS, default=4): cv.int_range(min=0, max=64),
+            cv.Optional(CONF_INTERVALS, default=4): cv.int_range(min=0, max=64),
+            cv.Optional(
+                CONF_STORM_INTERVAL, default="5s"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_DURATION): cv.positive_time_period_milliseconds,
+        }
+    ).extend(cv.polling_component_schema("10s")),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    # Replace operator new of the host platform with one that counts allocations
+    cg.add_define("USE_HOST_HEAP_COUNTER")
+
+    cg.add(var.set_num_components(config[CONF_COMPONENTS]))
+    cg.add(var.set_num_timeouts(config[CONF_TIMEOUTS]))
+    cg.add(var.set_num_intervals(config[CONF_INTERVALS]))
+    cg.add(var.set_storm_interval(config[CONF_STORM_INTERVAL]))
+    if CONF_DURATION in config:
+        cg.add(var.set_duration(config[CONF_DURATION]))
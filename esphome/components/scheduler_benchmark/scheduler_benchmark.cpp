@@ -0,0 +1,153 @@
+#include "scheduler_benchmark.h"
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+#ifdef USE_HOST_HEAP_COUNTER
+#include "esphome/components/host/core.h"
+#endif
+
+namespace esphome {
+namespace scheduler_benchmark {
+
+static const char *const TAG = "scheduler_benchmark";
+
+void SchedulerBenchmark::setup() {
+  for (uint8_t i = 0; i < this->num_timeouts_; i++)
+    this->timeout_names_.push_back("timeout_" + to_string(i));
+  for (uint8_t i = 0; i < this->num_intervals_; i++)
+    this->interval_names_.push_back("interval_" + to_string(i));
+
+  this->loads_.reset(new BenchmarkLoad[this->num_components_]);  // NOLINT
+  for (uint16_t c = 0; c < this->num_components_; c++) {
+    BenchmarkLoad *load = &this->loads_[c];
+    for (uint8_t i = 0; i < this->num_timeouts_; i++)
+      this->arm_timeout_(load, i);
+    for (uint8_t i = 0; i < this->num_intervals_; i++) {
+      // 100 ms up to 3.2 s, like typical update intervals
+      uint32_t interval = 100 << (i % 6);
+      App.scheduler.set_interval(load, this->interval_names_[i], interval, [this]() {
+        this->callback_start_();
+        this->intervals_fired_++;
+        this->callback_end_();
+      });
+    }
+  }
+
+  this->set_interval("storm", this->storm_interval_, [this]() { this->run_storm_(); });
+  if (this->duration_ != 0) {
+    this->set_timeout("duration", this->duration_, [this]() {
+      this->update();
+      ESP_LOGI(TAG, "Benchmark finished");
+      App.reboot();
+    });
+  }
+
+  this->last_report_ = millis();
+#ifdef USE_HOST_HEAP_COUNTER
+  this->last_allocations_ = host::get_heap_allocations();
+#endif
+}
+
+void SchedulerBenchmark::arm_timeout_(BenchmarkLoad *load, uint8_t index) {
+  // 10 ms up to 1.28 s with some jitter, like debounce filters and sensor state machines. Uses a cheap LCG so that
+  // random_uint32() doesn't end up in the measured set_timeout() cost.
+  this->seed_ = this->seed_ * 1664525UL + 1013904223UL;
+  const uint32_t delay = (10 << (index % 8)) + (this->seed_ >> 16) % 10;
+  const uint32_t deadline = millis() + delay;
+  App.scheduler.set_timeout(load, this->timeout_names_[index], delay, [this, load, index, deadline]() {
+    this->callback_start_();
+    this->timeout_lateness_.add(millis() - deadline);
+    this->arm_timeout_(load, index);
+    this->callback_end_();
+  });
+}
+
+void SchedulerBenchmark::run_storm_() {
+  this->callback_start_();
+  for (uint16_t c = 0; c < this->num_components_; c++) {
+    BenchmarkLoad *load = &this->loads_[c];
+    for (uint8_t i = 0; i < this->num_timeouts_; i++) {
+      uint32_t start = micros();
+      App.scheduler.cancel_timeout(load, this->timeout_names_[i]);
+      uint32_t mid = micros();
+      this->arm_timeout_(load, i);
+      uint32_t end = micros();
+      this->cancel_timeout_cost_.add(mid - start);
+      this->set_timeout_cost_.add(end - mid);
+    }
+  }
+  this->callback_end_();
+}
+
+void SchedulerBenchmark::callback_start_() {
+  // Only the time between two callbacks of the same Scheduler::call() is pure scheduler overhead
+  if (this->last_callback_loop_ == this->loop_count_)
+    this->dispatch_.add(micros() - this->last_callback_end_us_);
+}
+
+void SchedulerBenchmark::callback_end_() {
+  this->last_callback_loop_ = this->loop_count_;
+  this->last_callback_end_us_ = micros();
+}
+
+void SchedulerBenchmark::loop() {
+  const uint32_t now = micros();
+  if (this->loop_count_ != 0)
+    this->loop_period_.add(now - this->last_loop_us_);
+  this->last_loop_us_ = now;
+  this->loop_count_++;
+}
+
+void SchedulerBenchmark::update() {
+  const uint32_t now = millis();
+  const float elapsed = (now - this->last_report_) / 1000.0f;
+  if (elapsed <= 0.0f)
+    return;
+
+  ESP_LOGI(TAG, "Report for the last %.1fs:", elapsed);
+  ESP_LOGI(TAG, "  Loop: %.1f/s, period avg %.2f ms, max %.2f ms", this->loop_period_.count / elapsed,
+           this->loop_period_.avg() / 1000.0f, this->loop_period_.max / 1000.0f);
+  ESP_LOGI(TAG, "  Timeouts: %.1f/s, lateness avg %.2f ms, max %u ms", this->timeout_lateness_.count / elapsed,
+           this->timeout_lateness_.avg(), this->timeout_lateness_.max);
+  ESP_LOGI(TAG, "  Intervals: %.1f/s", this->intervals_fired_ / elapsed);
+  ESP_LOGI(TAG, "  Dispatch overhead: avg %.2f us, max %u us per callback", this->dispatch_.avg(), this->dispatch_.max);
+  ESP_LOGI(TAG, "  set_timeout: avg %.2f us, max %u us", this->set_timeout_cost_.avg(), this->set_timeout_cost_.max);
+  ESP_LOGI(TAG, "  cancel_timeout: avg %.2f us, max %u us", this->cancel_timeout_cost_.avg(),
+           this->cancel_timeout_cost_.max);
+#ifdef USE_HOST_HEAP_COUNTER
+  const uint32_t allocations = host::get_heap_allocations();
+  ESP_LOGI(TAG, "  Heap allocations: %.1f/s", (allocations - this->last_allocations_) / elapsed);
+  this->last_allocations_ = allocations;
+#endif
+
+  this->loop_period_.reset();
+  this->timeout_lateness_.reset();
+  this->dispatch_.reset();
+  this->set_timeout_cost_.reset();
+  this->cancel_timeout_cost_.reset();
+  this->intervals_fired_ = 0;
+  this->last_report_ = now;
+}
+
+void SchedulerBenchmark::dump_config() {
+  ESP_LOGCONFIG(TAG, "Scheduler Benchmark:");
+  ESP_LOGCONFIG(TAG, "  Components: %u", this->num_components_);
+  ESP_LOGCONFIG(TAG, "  Timeouts per component: %u", this->num_timeouts_);
+  ESP_LOGCONFIG(TAG, "  Intervals per component: %u", this->num_intervals_);
+  ESP_LOGCONFIG(TAG, "  Storm Interval: %" PRIu32 " ms", this->storm_interval_);
+  if (this->duration_ != 0)
+    ESP_LOGCONFIG(TAG, "  Duration: %" PRIu32 " ms", this->duration_);
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  ESP_LOGCONFIG(TAG, "  Scheduler: timer_wheel");
+#else
+  ESP_LOGCONFIG(TAG, "  Scheduler: heap");
+#endif
+  LOG_UPDATE_INTERVAL(this);
+}
+
+}  // namespace scheduler_benchmark
+}  // namespace esphome
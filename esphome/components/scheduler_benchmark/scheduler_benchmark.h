@@ -0,0 +1,86 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace scheduler_benchmark {
+
+/// Running count/sum/max of a measurement, reset after every report.
+struct BenchmarkStat {
+  uint32_t count{0};
+  uint64_t sum{0};
+  uint32_t max{0};
+
+  void add(uint32_t value) {
+    this->count++;
+    this->sum += value;
+    this->max = std::max(this->max, value);
+  }
+  float avg() const { return this->count == 0 ? 0.0f : float(this->sum) / this->count; }
+  void reset() { *this = BenchmarkStat{}; }
+};
+
+/// Stand-in for a regular component (sensor, filter, ...) that owns timeouts and intervals. Never registered with App.
+class BenchmarkLoad : public Component {};
+
+/** Synthetic scheduler load generator for the host platform.
+ *
+ * Creates `num_components` components with `num_timeouts` self re-arming timeouts and `num_intervals` intervals each,
+ * and every `storm_interval` cancels and re-arms all of the timeouts at once. Every `update_interval` it logs the
+ * main loop period, how late timeouts fire, the scheduler overhead between two callbacks of the same
+ * Scheduler::call(), the cost of set_timeout()/cancel_timeout() and the number of heap allocations per second.
+ */
+class SchedulerBenchmark : public PollingComponent {
+ public:
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_num_components(uint16_t num_components) { this->num_components_ = num_components; }
+  void set_num_timeouts(uint8_t num_timeouts) { this->num_timeouts_ = num_timeouts; }
+  void set_num_intervals(uint8_t num_intervals) { this->num_intervals_ = num_intervals; }
+  void set_storm_interval(uint32_t storm_interval) { this->storm_interval_ = storm_interval; }
+  void set_duration(uint32_t duration) { this->duration_ = duration; }
+
+ protected:
+  void arm_timeout_(BenchmarkLoad *load, uint8_t index);
+  void run_storm_();
+  void callback_start_();
+  void callback_end_();
+
+  uint16_t num_components_{100};
+  uint8_t num_timeouts_{4};
+  uint8_t num_intervals_{4};
+  uint32_t storm_interval_{5000};
+  uint32_t duration_{0};
+
+  std::unique_ptr<BenchmarkLoad[]> loads_;
+  std::vector<std::string> timeout_names_;
+  std::vector<std::string> interval_names_;
+
+  BenchmarkStat loop_period_;
+  BenchmarkStat timeout_lateness_;
+  BenchmarkStat dispatch_;
+  BenchmarkStat set_timeout_cost_;
+  BenchmarkStat cancel_timeout_cost_;
+  uint32_t intervals_fired_{0};
+
+  uint32_t loop_count_{0};
+  uint32_t last_loop_us_{0};
+  /// Loop iteration and time at which the last callback returned, to find consecutive callbacks of one call().
+  uint32_t last_callback_loop_{0};
+  uint32_t last_callback_end_us_{0};
+  uint32_t last_report_{0};
+  uint32_t last_allocations_{0};
+  uint32_t seed_{1};
+};
+
+}  // namespace scheduler_benchmark
+}  // namespace esphome
@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -31,40 +32,60 @@ void Filter::initialize(Sensor *parent, Filter *next) {
   this->next_ = next;
 }
 
+// SortedWindow
+SortedWindow::SortedWindow(size_t window_size) { this->set_window_size(window_size); }
+void SortedWindow::set_window_size(size_t window_size) {
+  window_size = std::max<size_t>(window_size, 1);
+  std::vector<float> values;
+  values.reserve(this->ring_.size());
+  for (size_t i = 0; i < this->ring_.size(); i++)
+    values.push_back(this->ring_[(this->head_ + i) % this->ring_.size()]);
+
+  this->window_size_ = window_size;
+  this->ring_.clear();
+  this->ring_.shrink_to_fit();
+  this->ring_.reserve(window_size);
+  this->head_ = 0;
+  this->sorted_.clear();
+  this->sorted_.shrink_to_fit();
+  this->sorted_.reserve(window_size);
+  for (size_t i = values.size() > window_size ? values.size() - window_size : 0; i < values.size(); i++)
+    this->push(values[i]);
+}
+void SortedWindow::push(float value) {
+  if (this->ring_.size() < this->window_size_) {
+    this->ring_.push_back(value);
+  } else {
+    float &oldest = this->ring_[this->head_];
+    if (!std::isnan(oldest))
+      this->sorted_.erase(std::lower_bound(this->sorted_.begin(), this->sorted_.end(), oldest));
+    oldest = value;
+    this->head_ = (this->head_ + 1) % this->window_size_;
+  }
+  if (!std::isnan(value))
+    this->sorted_.insert(std::upper_bound(this->sorted_.begin(), this->sorted_.end(), value), value);
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MedianFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
+    // NaN values are not part of the sorted window
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t size = this->window_.size();
+    if (size) {
+      if (size % 2) {
+        median = this->window_[size / 2];
+      } else {
+        median = (this->window_[size / 2] + this->window_[(size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -89,38 +110,24 @@ optional<float> SkipInitialFilter::new_value(float value) {
 
 // QuantileFilter
 QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {}
 void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
+    // NaN values are not part of the sorted window
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t size = this->window_.size();
+    if (size) {
+      size_t position = ceilf(size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, size);
+      result = this->window_[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -131,26 +138,17 @@ optional<float> QuantileFilter::new_value(float value) {
 
 // MinFilter
 MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MinFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
-
+    float min = this->window_.get();
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
   }
@@ -159,26 +157,17 @@ optional<float> MinFilter::new_value(float value) {
 
 // MaxFilter
 MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MaxFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
-
+    float max = this->window_.get();
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
   }
@@ -188,31 +177,82 @@ optional<float> MaxFilter::new_value(float value) {
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->set_window_size(window_size);
+}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  window_size = std::max<size_t>(window_size, 1);
+  // Keep the newest values that still fit, in arrival order
+  std::vector<float> values;
+  values.reserve(window_size);
+  size_t skip = this->ring_.size() > window_size ? this->ring_.size() - window_size : 0;
+  for (size_t i = skip; i < this->ring_.size(); i++)
+    values.push_back(this->ring_[(this->head_ + i) % this->ring_.size()]);
+
+  this->ring_ = std::move(values);
+  this->ring_.reserve(window_size);
+  this->head_ = 0;
+  this->window_size_ = window_size;
+  this->recalculate_sum_();
+}
+void SlidingWindowMovingAverageFilter::recalculate_sum_() {
+  this->sum_ = this->compensation_ = 0.0f;
+  this->valid_count_ = this->pos_inf_count_ = this->neg_inf_count_ = 0;
+  for (float v : this->ring_)
+    this->update_sum_(v, 1);
+}
+void SlidingWindowMovingAverageFilter::update_sum_(float value, int sign) {
+  if (std::isnan(value))
+    return;
+  this->valid_count_ += sign;
+  if (std::isinf(value)) {
+    (value > 0 ? this->pos_inf_count_ : this->neg_inf_count_) += sign;
+    return;
+  }
+  if (this->valid_count_ == this->pos_inf_count_ + this->neg_inf_count_) {
+    // No finite values left, start over without the leftover rounding error
+    this->sum_ = this->compensation_ = 0.0f;
+    return;
+  }
+  // Kahan-Babuska (Neumaier) summation, also compensates when a value larger than the current sum leaves the window
+  const float v = sign * value;
+  const float t = this->sum_ + v;
+  if (std::fabs(this->sum_) >= std::fabs(v)) {
+    this->compensation_ += (this->sum_ - t) + v;
+  } else {
+    this->compensation_ += (v - t) + this->sum_;
+  }
+  this->sum_ = t;
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
+  if (this->ring_.size() < this->window_size_) {
+    this->ring_.push_back(value);
+  } else {
+    this->update_sum_(this->ring_[this->head_], -1);
+    this->ring_[this->head_] = value;
+    this->head_ = (this->head_ + 1) % this->window_size_;
+  }
+  this->update_sum_(value, 1);
+  if (this->head_ == 0 && this->ring_.size() == this->window_size_) {
+    // Once per pass through the window, sum it up from scratch. This keeps the error of values that left the window a
+    // long time ago, possibly orders of magnitude larger than the current ones, from lingering in the compensation.
+    this->recalculate_sum_();
   }
-  this->queue_.push_back(value);
   ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float sum = 0;
-    size_t valid_count = 0;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        sum += v;
-        valid_count++;
-      }
-    }
-
     float average = NAN;
-    if (valid_count) {
-      average = sum / valid_count;
+    if (this->pos_inf_count_ && this->neg_inf_count_) {
+      average = NAN;
+    } else if (this->pos_inf_count_) {
+      average = INFINITY;
+    } else if (this->neg_inf_count_) {
+      average = -INFINITY;
+    } else if (this->valid_count_) {
+      average = (this->sum_ + this->compensation_) / this->valid_count_;
     }
 
     ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f) SENDING %f", this, value, average);
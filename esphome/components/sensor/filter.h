@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cmath>
+#include <functional>
 #include <queue>
 #include <utility>
 #include <vector>
@@ -43,6 +45,32 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** Sliding window over the last `window_size` values that also keeps its non-NaN values sorted.
+ *
+ * Storage for the whole window is allocated up front. A new value is placed with a binary search and the value it
+ * evicts is removed the same way, so order statistics like the median can be read directly instead of copying and
+ * sorting the window for every sample.
+ */
+class SortedWindow {
+ public:
+  explicit SortedWindow(size_t window_size);
+
+  void push(float value);
+  /// Resize the window, keeping the newest values that still fit.
+  void set_window_size(size_t window_size);
+
+  /// Number of non-NaN values in the window.
+  size_t size() const { return this->sorted_.size(); }
+  /// The n-th smallest non-NaN value in the window.
+  float operator[](size_t n) const { return this->sorted_[n]; }
+
+ protected:
+  size_t window_size_{0};
+  std::vector<float> ring_;  ///< All values including NaN, in arrival order starting at head_ once full.
+  size_t head_{0};
+  std::vector<float> sorted_;
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -67,10 +95,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -96,10 +123,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -120,6 +146,71 @@ class SkipInitialFilter : public Filter {
   size_t num_to_ignore_;
 };
 
+/** Sliding window minimum or maximum in amortized O(1) per value.
+ *
+ * Keeps a monotonic queue of the values that can still become the extreme of the last `window_size` values, together
+ * with the index of the sample they arrived with. A value that is beaten by a newer one can never be the result again
+ * and is dropped right away, so the front of the queue is always the result. NaN values are ignored. Storage for the
+ * whole window is allocated up front.
+ *
+ * @tparam Compare std::less<float> for the minimum, std::greater<float> for the maximum.
+ */
+template<typename Compare> class MonotonicWindow {
+ public:
+  explicit MonotonicWindow(size_t window_size) { this->set_window_size(window_size); }
+
+  void push(float value) {
+    const uint32_t index = this->count_++;
+    // Drop values that slid out of the window
+    while (this->size_ && index - this->entries_[this->head_].index >= this->window_size_) {
+      this->head_ = (this->head_ + 1) % this->entries_.size();
+      this->size_--;
+    }
+    if (std::isnan(value))
+      return;
+    // Equal older values are kept, so the oldest extreme wins like with a linear scan
+    while (this->size_ && Compare()(value, this->back_().value))
+      this->size_--;
+    this->size_++;
+    this->back_() = Entry{index, value};
+  }
+
+  /// Resize the window, keeping the values that are still in it.
+  void set_window_size(size_t window_size) {
+    window_size = std::max<size_t>(window_size, 1);
+    std::vector<Entry> entries;
+    entries.reserve(window_size);
+    for (size_t i = 0; i < this->size_; i++) {
+      const Entry &entry = this->entries_[(this->head_ + i) % this->entries_.size()];
+      // Only keep what is still in the window once the next value arrives
+      if (this->count_ - entry.index < window_size)
+        entries.push_back(entry);
+    }
+    this->size_ = entries.size();
+    this->head_ = 0;
+    entries.resize(window_size);
+    this->entries_ = std::move(entries);
+    this->window_size_ = window_size;
+  }
+
+  /// The minimum/maximum of the window, NaN if it only holds NaN values.
+  float get() const { return this->size_ ? this->entries_[this->head_].value : NAN; }
+
+ protected:
+  struct Entry {
+    uint32_t index;
+    float value;
+  };
+
+  Entry &back_() { return this->entries_[(this->head_ + this->size_ - 1) % this->entries_.size()]; }
+
+  std::vector<Entry> entries_;
+  size_t head_{0};
+  size_t size_{0};
+  size_t window_size_{0};
+  uint32_t count_{0};
+};
+
 /** Simple min filter.
  *
  * Takes the min of the last <send_every> values and pushes it out every <send_every>.
@@ -142,10 +233,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::less<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -170,16 +260,19 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::greater<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
  *
  * Essentially just takes takes the average of the last window_size values and pushes them out
  * every send_every.
+ *
+ * The window is a ring buffer allocated up front, and the sum of its values is updated as values enter and leave
+ * it. The running sum is Kahan compensated and recalculated once per pass through the window, so rounding errors
+ * don't pile up over time. Infinite values are counted instead of summed, so they can leave the window again.
  */
 class SlidingWindowMovingAverageFilter : public Filter {
  public:
@@ -199,10 +292,21 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /// Add a value to the running sum (sign 1) or remove it again (sign -1).
+  void update_sum_(float value, int sign);
+  void recalculate_sum_();
+
+  std::vector<float> ring_;
+  size_t head_{0};
+  size_t window_size_{0};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
+
+  float sum_{0.0f};
+  float compensation_{0.0f};
+  size_t valid_count_{0};  ///< Non-NaN values in the window, including infinite ones.
+  size_t pos_inf_count_{0};
+  size_t neg_inf_count_{0};
 };
 
 /** Simple exponential moving average filter.
@@ -107,6 +107,7 @@ class BSDSocketImpl : public Socket {
     return ::sendto(fd_, buf, len, flags, to, tolen);
   }
 
+  int get_fd() const override { return fd_; }
   int setblocking(bool blocking) override {
     int fl = ::fcntl(fd_, F_GETFL, 0);
     if (blocking) {
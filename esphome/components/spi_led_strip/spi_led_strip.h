@@ -80,6 +80,18 @@ class SpiLedStrip : public light::AddressableLight,
     return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
             this->effect_data_ + index, &this->correction_};
   }
+  light::ESPPixelBuffer get_pixel_buffer_internal() const override {
+    light::ESPPixelBuffer buffer;
+    // The LEDs follow the 4 byte start frame and the brightness byte of the first LED
+    buffer.pixels = this->buf_ == nullptr ? nullptr : this->buf_ + 5;
+    buffer.effect_data = this->effect_data_;
+    buffer.stride = 4;
+    buffer.channels = 3;
+    buffer.offsets[0] = 2;
+    buffer.offsets[1] = 1;
+    buffer.offsets[2] = 0;
+    return buffer;
+  }
 
   size_t buffer_size_{};
   uint8_t *effect_data_{nullptr};
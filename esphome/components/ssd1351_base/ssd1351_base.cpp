@@ -49,6 +49,7 @@ static const uint8_t SSD1351_STARTSCROLL = 0x9F;
 
 void SSD1351::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tracking_(SSD1351_BYTESPERPIXEL);
 
   this->command(SSD1351_COMMANDLOCK);
   this->data(0x12);
@@ -97,11 +98,24 @@ void SSD1351::display() {
   this->data(0x00);                  // set row start address
   this->data(0x7F);                  // set last row
   this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  this->write_display_data(this->buffer_, this->get_buffer_length_());
 }
 void SSD1351::update() {
   this->do_update_();
-  this->display();
+  this->flush_dirty_();
+}
+size_t SSD1351::write_window_(const display::Rect &window) {
+  // Send whole rows, they are one contiguous part of the buffer
+  const size_t row_length = size_t(this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
+  this->command(SSD1351_SETCOLUMN);
+  this->data(0x00);
+  this->data(0x7F);
+  this->command(SSD1351_SETROW);
+  this->data(window.y);
+  this->data(window.y2() - 1);
+  this->command(SSD1351_WRITERAM);
+  this->write_display_data(this->buffer_ + window.y * row_length, window.h * row_length);
+  return window.h * row_length;
 }
 void SSD1351::set_brightness(float brightness) {
   // validation
@@ -158,6 +172,7 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   uint16_t pos = (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
   this->buffer_[pos++] = (color565 >> 8) & 0xff;
   this->buffer_[pos] = color565 & 0xff;
+  this->mark_dirty_(x, y);
 }
 void SSD1351::fill(Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
@@ -168,6 +183,7 @@ void SSD1351::fill(Color color) {
       this->buffer_[i] = (color565 >> 8) & 0xff;
     }
   }
+  this->mark_all_dirty_();
 }
 void SSD1351::init_reset_() {
   if (this->reset_pin_ != nullptr) {
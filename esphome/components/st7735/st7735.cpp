@@ -289,11 +289,12 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  this->init_dirty_tracking_(this->eightbitcolor_ ? 1 : 2);
 }
 
 void ST7735::update() {
   this->do_update_();
-  this->write_display_data_();
+  this->flush_dirty_();
 }
 
 int ST7735::get_height_internal() { return height_; }
@@ -321,6 +322,7 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->mark_dirty_(x, y);
 }
 
 void ST7735::init_reset_() {
@@ -417,14 +419,15 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
   this->disable();
 }
 
-void HOT ST7735::write_display_data_() {
+size_t HOT ST7735::write_window_(const display::Rect &window) {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  uint16_t x1 = offsetx + window.x;
+  uint16_t x2 = x1 + window.w - 1;
+  uint16_t y1 = offsety + window.y;
+  uint16_t y2 = y1 + window.h - 1;
+  const size_t width = this->get_width_internal();
 
   this->enable();
 
@@ -446,8 +449,8 @@ void HOT ST7735::write_display_data_() {
   this->dc_pin_->digital_write(true);
 
   if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (size_t line = window.y * width; line < window.y2() * width; line = line + width) {
+      for (int index = window.x; index < window.x2(); ++index) {
         auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
@@ -457,10 +460,15 @@ void HOT ST7735::write_display_data_() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (size_t(window.w) == width) {
+    // Full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + window.y * width * 2, window.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    for (size_t line = window.y; line < size_t(window.y2()); line++)
+      this->write_array(this->buffer_ + (line * width + window.x) * 2, window.w * 2);
   }
   this->disable();
+  return size_t(window.w) * window.h * 2;
 }
 
 void ST7735::spi_master_write_addr_(uint16_t addr1, uint16_t addr2) {
@@ -61,7 +61,7 @@ class ST7735 : public display::DisplayBuffer,
   void writecommand_(uint8_t value);
   void writedata_(uint8_t value);
 
-  void write_display_data_();
+  size_t write_window_(const display::Rect &window) override;
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
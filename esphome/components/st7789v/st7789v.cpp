@@ -118,6 +118,7 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  this->init_dirty_tracking_(this->eightbitcolor_ ? 1 : 2);
 }
 
 void ST7789V::dump_config() {
@@ -143,16 +144,21 @@ float ST7789V::get_setup_priority() const { return setup_priority::PROCESSOR; }
 
 void ST7789V::update() {
   this->do_update_();
-  this->write_display_data();
+  this->flush_dirty_();
 }
 
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  this->write_window_(display::Rect(0, 0, this->get_width_internal(), this->get_height_internal()));
+}
+
+size_t ST7789V::write_window_(const display::Rect &window) {
+  uint16_t x1 = this->offset_height_ + window.x;
+  uint16_t x2 = x1 + window.w - 1;
+  uint16_t y1 = this->offset_width_ + window.y;
+  uint16_t y2 = y1 + window.h - 1;
+  const size_t width = this->get_width_internal();
 
   this->enable();
 
@@ -174,8 +180,8 @@ void ST7789V::write_display_data() {
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (size_t line = window.y * width; line < window.y2() * width; line = line + width) {
+      for (int index = window.x; index < window.x2(); ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -189,11 +195,16 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (size_t(window.w) == width) {
+    // Full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + window.y * width * 2, window.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (size_t line = window.y; line < size_t(window.y2()); line++)
+      this->write_array(this->buffer_ + (line * width + window.x) * 2, window.w * 2);
   }
 
   this->disable();
+  return size_t(window.w) * window.h * 2;
 }
 
 void ST7789V::init_reset_() {
@@ -303,6 +314,42 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->mark_dirty_(x, y);
+}
+
+void HOT ST7789V::fill_rect_internal_(int x, int y, int width, int height, Color color) {
+  const uint16_t color565 = display::ColorUtil::color_to_565(color);
+  const uint8_t color332 = display::ColorUtil::color_to_332(color);
+  for (int row = y; row < y + height; row++) {
+    const uint32_t pos = row * this->width_ + x;
+    if (this->eightbitcolor_) {
+      memset(this->buffer_ + pos, color332, width);
+    } else {
+      uint8_t *data = this->buffer_ + pos * 2;
+      for (int i = 0; i < width; i++) {
+        *data++ = color565 >> 8;
+        *data++ = color565;
+      }
+    }
+  }
+  this->mark_dirty_(x, y, width, height);
+}
+
+void HOT ST7789V::write_pixels_internal_(int x, int y, int dx, int dy, const Color *colors, int count) {
+  const int32_t step = dx + dy * this->width_;
+  int32_t pos = y * this->width_ + x;
+  for (int i = 0; i < count; i++, pos += step) {
+    if (this->eightbitcolor_) {
+      this->buffer_[pos] = display::ColorUtil::color_to_332(colors[i]);
+    } else {
+      const uint16_t color565 = display::ColorUtil::color_to_565(colors[i]);
+      this->buffer_[pos * 2] = color565 >> 8;
+      this->buffer_[pos * 2 + 1] = color565;
+    }
+  }
+  const int x2 = x + dx * (count - 1);
+  const int y2 = y + dy * (count - 1);
+  this->mark_dirty_(std::min(x, x2), std::min(y, y2), abs(x2 - x) + 1, abs(y2 - y) + 1);
 }
 
 }  // namespace st7789v
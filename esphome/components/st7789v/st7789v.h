@@ -164,6 +164,9 @@ class ST7789V : public display::DisplayBuffer,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_rect_internal_(int x, int y, int width, int height, Color color) override;
+  void write_pixels_internal_(int x, int y, int dx, int dy, const Color *colors, int count) override;
+  size_t write_window_(const display::Rect &window) override;
 
   const char *model_str_;
 };
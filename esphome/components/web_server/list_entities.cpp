@@ -106,5 +106,10 @@ bool ListEntitiesIterator::on_alarm_control_panel(alarm_control_panel::AlarmCont
 }
 #endif
 
+bool ListEntitiesIterator::on_end() {
+  this->web_server_->send_snapshot_event_();
+  return true;
+}
+
 }  // namespace web_server
 }  // namespace esphome
@@ -12,6 +12,7 @@
 #endif
 
 #include <cstdlib>
+#include <cstring>
 
 #ifdef USE_LIGHT
 #include "esphome/components/light/light_json_schema.h"
@@ -33,6 +34,8 @@ namespace esphome {
 namespace web_server {
 
 static const char *const TAG = "web_server";
+/// Version of the delta events format, announced in the "ping" event sent on connect.
+static const uint8_t DELTA_EVENTS_FORMAT_VERSION = 1;
 
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
 static const char *const HEADER_PNA_NAME = "Private-Network-Access-Name";
@@ -110,12 +113,14 @@ void WebServer::set_js_include(const char *js_include) { this->js_include_ = js_
 #endif
 
 std::string WebServer::get_config_json() {
-  return json::build_json([this](JsonObject root) {
-    root["title"] = App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name();
-    root["comment"] = App.get_comment();
-    root["ota"] = this->allow_ota_;
-    root["log"] = this->expose_log_;
-    root["lang"] = "en";
+  return json::write_json([this](json::JsonWriter &writer) {
+    writer.add("title", App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name());
+    writer.add("comment", App.get_comment());
+    writer.add("ota", this->allow_ota_);
+    writer.add("log", this->expose_log_);
+    writer.add("lang", "en");
+    if (this->delta_events_)
+      writer.add("delta_events", DELTA_EVENTS_FORMAT_VERSION);
   });
 }
 
@@ -161,6 +166,9 @@ void WebServer::loop() {
       fn();
     }
   }
+#endif
+#ifdef USE_ESP_IDF
+  this->events_.loop();
 #endif
   this->entities_iterator_.advance();
 }
@@ -395,38 +403,118 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 }
 #endif
 
-#define set_json_id(root, obj, sensor, start_config) \
-  (root)["id"] = sensor; \
-  if (((start_config) == DETAIL_ALL)) \
-    (root)["name"] = (obj)->get_name();
+void WebServer::send_state_event_(EntityBase *obj, const std::string &data) {
+  if (!this->delta_events_) {
+    this->events_.send(data.c_str(), "state");
+    return;
+  }
+
+  // Split the object into its top level members, the JSON is generated by JsonWriter so there's no whitespace
+  std::vector<std::pair<size_t, size_t>> members;
+  size_t start = 1;
+  uint8_t depth = 0;
+  bool in_string = false;
+  for (size_t i = 1; i < data.size(); i++) {
+    const char c = data[i];
+    if (in_string) {
+      if (c == '\\')
+        i++;
+      else if (c == '"')
+        in_string = false;
+    } else if (c == '"') {
+      in_string = true;
+    } else if (c == '{' || c == '[') {
+      depth++;
+    } else if ((c == '}' || c == ']') && depth > 0) {
+      depth--;
+    } else if ((c == ',' || c == '}') && depth == 0) {
+      members.emplace_back(start, i - start);
+      start = i + 1;
+    }
+  }
+
+  auto &last = this->state_members_[obj];
+  if (last.size() != members.size()) {
+    // Different members than last time, e.g. a climate that started reporting its action: send everything
+    last.resize(members.size());
+    for (size_t i = 0; i < members.size(); i++)
+      last[i].assign(&data[members[i].first], members[i].second);
+    this->events_.send(data.c_str(), "state", ++this->state_version_);
+    return;
+  }
+
+  // Always keep the id and the state, that's what simple clients like the version 1 page read
+  std::string delta = "{";
+  bool changed = false;
+  for (size_t i = 0; i < members.size(); i++) {
+    const char *member = &data[members[i].first];
+    const size_t len = members[i].second;
+    const bool keep = strncmp(member, "\"id\":", 5) == 0 || strncmp(member, "\"state\":", 8) == 0;
+    if (last[i].size() != len || memcmp(last[i].data(), member, len) != 0) {
+      last[i].assign(member, len);
+      changed = true;
+    } else if (!keep) {
+      continue;
+    }
+    if (delta.size() > 1)
+      delta += ',';
+    delta.append(member, len);
+  }
+  if (!changed)
+    return;
+  delta += '}';
+  // The event id is the state version, clients can tell from it which deltas apply on top of a snapshot
+  this->events_.send(delta.c_str(), "state", ++this->state_version_);
+}
+
+void WebServer::send_snapshot_event_() {
+  if (!this->delta_events_)
+    return;
+  // All entities were sent in full since the client connected, later deltas apply on top of this version
+  this->events_.send(json::write_json([this](json::JsonWriter &writer) {
+                       writer.add("version", this->state_version_);
+                     }).c_str(),
+                     "snapshot", this->state_version_);
+}
 
-#define set_json_value(root, obj, sensor, value, start_config) \
-  set_json_id((root), (obj), sensor, start_config)(root)["value"] = value;
+static void set_json_id(json::JsonWriter &writer, EntityBase *obj, const std::string &id, JsonDetail start_config) {
+  writer.add("id", id);
+  if (start_config == DETAIL_ALL)
+    writer.add("name", obj->get_name());
+}
 
-#define set_json_state_value(root, obj, sensor, state, value, start_config) \
-  set_json_value(root, obj, sensor, value, start_config)(root)["state"] = state;
+template<typename S, typename V>
+static void set_json_state_value(json::JsonWriter &writer, EntityBase *obj, const std::string &id, const S &state,
+                                 const V &value, JsonDetail start_config) {
+  set_json_id(writer, obj, id, start_config);
+  writer.add("value", value);
+  writer.add("state", state);
+}
 
-#define set_json_icon_state_value(root, obj, sensor, state, value, start_config) \
-  set_json_value(root, obj, sensor, value, start_config)(root)["state"] = state; \
-  if (((start_config) == DETAIL_ALL)) \
-    (root)["icon"] = (obj)->get_icon();
+template<typename S, typename V>
+static void set_json_icon_state_value(json::JsonWriter &writer, EntityBase *obj, const std::string &id, const S &state,
+                                      const V &value, JsonDetail start_config) {
+  set_json_state_value(writer, obj, id, state, value, start_config);
+  if (start_config == DETAIL_ALL)
+    writer.add("icon", obj->get_icon());
+}
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->sensor_json(obj, state, DETAIL_STATE));
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  sensor::Sensor *obj = App.get_sensor_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", data.c_str());
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
+  return json::write_json([obj, value, start_config](json::JsonWriter &writer) {
     std::string state;
     if (std::isnan(value)) {
       state = "NA";
@@ -435,284 +523,288 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
       if (!obj->get_unit_of_measurement().empty())
         state += " " + obj->get_unit_of_measurement();
     }
-    set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
+    set_json_icon_state_value(writer, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
   });
 }
 #endif
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->text_sensor_json(obj, state, DETAIL_STATE));
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  text_sensor::TextSensor *obj = App.get_text_sensor_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", data.c_str());
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
+  return json::write_json([obj, &value, start_config](json::JsonWriter &writer) {
+    set_json_icon_state_value(writer, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
   });
 }
 #endif
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->switch_json(obj, state, DETAIL_STATE));
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &writer) {
+    set_json_icon_state_value(writer, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value,
+                              start_config);
     if (start_config == DETAIL_ALL) {
-      root["assumed_state"] = obj->assumed_state();
+      writer.add("assumed_state", obj->assumed_state());
     }
   });
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      this->schedule_([obj]() { obj->turn_on(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->schedule_([obj]() { obj->turn_off(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  switch_::Switch *obj = App.get_switch_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  if (request->method() == HTTP_GET) {
+    std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    this->schedule_([obj]() { obj->turn_on(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->schedule_([obj]() { obj->turn_off(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_BUTTON
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json(
-      [obj, start_config](JsonObject root) { set_json_id(root, obj, "button-" + obj->get_object_id(), start_config); });
+  return json::write_json([obj, start_config](json::JsonWriter &writer) {
+    set_json_id(writer, obj, "button-" + obj->get_object_id(), start_config);
+  });
 }
 
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_POST && match.method == "press") {
-      this->schedule_([obj]() { obj->press(); });
-      request->send(200);
-      return;
-    } else {
-      request->send(404);
-    }
+  button::Button *obj = App.get_button_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  if (request->method() == HTTP_POST && match.method == "press") {
+    this->schedule_([obj]() { obj->press(); });
+    request->send(200);
+    return;
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->binary_sensor_json(obj, state, DETAIL_STATE));
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &writer) {
+    set_json_state_value(writer, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
+                         start_config);
   });
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  binary_sensor::BinarySensor *obj = App.get_binary_sensor_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", data.c_str());
 }
 #endif
 
 #ifdef USE_FAN
-void WebServer::on_fan_update(fan::Fan *obj) { this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state"); }
+void WebServer::on_fan_update(fan::Fan *obj) { this->send_state_event_(obj, this->fan_json(obj, DETAIL_STATE)); }
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state, start_config);
+  return json::write_json([obj, start_config](json::JsonWriter &writer) {
+    set_json_state_value(writer, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
+                         start_config);
     const auto traits = obj->get_traits();
     if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
-      root["speed_count"] = traits.supported_speed_count();
+      writer.add("speed_level", obj->speed);
+      writer.add("speed_count", traits.supported_speed_count());
     }
     if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
+      writer.add("oscillation", obj->oscillating);
   });
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  fan::Fan *obj = App.get_fan_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    if (request->method() == HTTP_GET) {
-      std::string data = this->fan_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("speed_level")) {
-        auto speed_level = request->getParam("speed_level")->value();
-        auto val = parse_number<int>(speed_level.c_str());
-        if (!val.has_value()) {
-          ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
-          return;
-        }
-        call.set_speed(*val);
+  if (request->method() == HTTP_GET) {
+    std::string data = this->fan_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("speed_level")) {
+      auto speed_level = request->getParam("speed_level")->value();
+      auto val = parse_number<int>(speed_level.c_str());
+      if (!val.has_value()) {
+        ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+        return;
       }
-      if (request->hasParam("oscillation")) {
-        auto speed = request->getParam("oscillation")->value();
-        auto val = parse_on_off(speed.c_str());
-        switch (val) {
-          case PARSE_ON:
-            call.set_oscillating(true);
-            break;
-          case PARSE_OFF:
-            call.set_oscillating(false);
-            break;
-          case PARSE_TOGGLE:
-            call.set_oscillating(!obj->oscillating);
-            break;
-          case PARSE_NONE:
-            request->send(404);
-            return;
-        }
+      call.set_speed(*val);
+    }
+    if (request->hasParam("oscillation")) {
+      auto speed = request->getParam("oscillation")->value();
+      auto val = parse_on_off(speed.c_str());
+      switch (val) {
+        case PARSE_ON:
+          call.set_oscillating(true);
+          break;
+        case PARSE_OFF:
+          call.set_oscillating(false);
+          break;
+        case PARSE_TOGGLE:
+          call.set_oscillating(!obj->oscillating);
+          break;
+        case PARSE_NONE:
+          request->send(404);
+          return;
       }
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->schedule_([obj]() { obj->turn_off().perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->schedule_([obj]() { obj->turn_off().perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 #endif
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->light_json(obj, DETAIL_STATE));
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  light::LightState *obj = App.get_light_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    if (request->method() == HTTP_GET) {
-      std::string data = this->light_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("brightness")) {
-        auto brightness = parse_number<float>(request->getParam("brightness")->value().c_str());
-        if (brightness.has_value()) {
-          call.set_brightness(*brightness / 255.0f);
-        }
-      }
-      if (request->hasParam("r")) {
-        auto r = parse_number<float>(request->getParam("r")->value().c_str());
-        if (r.has_value()) {
-          call.set_red(*r / 255.0f);
-        }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->light_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("brightness")) {
+      auto brightness = parse_number<float>(request->getParam("brightness")->value().c_str());
+      if (brightness.has_value()) {
+        call.set_brightness(*brightness / 255.0f);
       }
-      if (request->hasParam("g")) {
-        auto g = parse_number<float>(request->getParam("g")->value().c_str());
-        if (g.has_value()) {
-          call.set_green(*g / 255.0f);
-        }
+    }
+    if (request->hasParam("r")) {
+      auto r = parse_number<float>(request->getParam("r")->value().c_str());
+      if (r.has_value()) {
+        call.set_red(*r / 255.0f);
       }
-      if (request->hasParam("b")) {
-        auto b = parse_number<float>(request->getParam("b")->value().c_str());
-        if (b.has_value()) {
-          call.set_blue(*b / 255.0f);
-        }
+    }
+    if (request->hasParam("g")) {
+      auto g = parse_number<float>(request->getParam("g")->value().c_str());
+      if (g.has_value()) {
+        call.set_green(*g / 255.0f);
       }
-      if (request->hasParam("white_value")) {
-        auto white_value = parse_number<float>(request->getParam("white_value")->value().c_str());
-        if (white_value.has_value()) {
-          call.set_white(*white_value / 255.0f);
-        }
+    }
+    if (request->hasParam("b")) {
+      auto b = parse_number<float>(request->getParam("b")->value().c_str());
+      if (b.has_value()) {
+        call.set_blue(*b / 255.0f);
       }
-      if (request->hasParam("color_temp")) {
-        auto color_temp = parse_number<float>(request->getParam("color_temp")->value().c_str());
-        if (color_temp.has_value()) {
-          call.set_color_temperature(*color_temp);
-        }
+    }
+    if (request->hasParam("white_value")) {
+      auto white_value = parse_number<float>(request->getParam("white_value")->value().c_str());
+      if (white_value.has_value()) {
+        call.set_white(*white_value / 255.0f);
       }
-      if (request->hasParam("flash")) {
-        auto flash = parse_number<uint32_t>(request->getParam("flash")->value().c_str());
-        if (flash.has_value()) {
-          call.set_flash_length(*flash * 1000);
-        }
+    }
+    if (request->hasParam("color_temp")) {
+      auto color_temp = parse_number<float>(request->getParam("color_temp")->value().c_str());
+      if (color_temp.has_value()) {
+        call.set_color_temperature(*color_temp);
       }
-      if (request->hasParam("transition")) {
-        auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
-        if (transition.has_value()) {
-          call.set_transition_length(*transition * 1000);
-        }
+    }
+    if (request->hasParam("flash")) {
+      auto flash = parse_number<uint32_t>(request->getParam("flash")->value().c_str());
+      if (flash.has_value()) {
+        call.set_flash_length(*flash * 1000);
       }
-      if (request->hasParam("effect")) {
-        const char *effect = request->getParam("effect")->value().c_str();
-        call.set_effect(effect);
+    }
+    if (request->hasParam("transition")) {
+      auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
+      if (transition.has_value()) {
+        call.set_transition_length(*transition * 1000);
       }
+    }
+    if (request->hasParam("effect")) {
+      const char *effect = request->getParam("effect")->value().c_str();
+      call.set_effect(effect);
+    }
 
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      auto call = obj->turn_off();
-      if (request->hasParam("transition")) {
-        auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
-        if (transition.has_value()) {
-          call.set_transition_length(*transition * 1000);
-        }
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    auto call = obj->turn_off();
+    if (request->hasParam("transition")) {
+      auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
+      if (transition.has_value()) {
+        call.set_transition_length(*transition * 1000);
       }
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
+  return json::write_json([obj, start_config](json::JsonWriter &writer) {
+    set_json_id(writer, obj, "light-" + obj->get_object_id(), start_config);
+    // dump_json() only writes the state if the color mode is known
+    if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
+      writer.add("state", obj->remote_values.is_on() ? "ON" : "OFF");
 
-    light::LightJSONSchema::dump_json(*obj, root);
+    light::LightJSONSchema::dump_json(*obj, writer);
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("effects");
-      opt.add("None");
+      writer.begin_array("effects");
+      writer.add("None");
       for (auto const &option : obj->get_effects()) {
-        opt.add(option->get_name());
+        writer.add(option->get_name());
       }
+      writer.end_array();
     }
   });
 }
@@ -720,120 +812,118 @@ std::string WebServer::light_json(light::LightState *obj, JsonDetail start_confi
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
-  this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->cover_json(obj, DETAIL_STATE));
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  cover::Cover *obj = App.get_cover_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    if (request->method() == HTTP_GET) {
-      std::string data = this->cover_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      continue;
-    }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->cover_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
-    if (match.method == "open") {
-      call.set_command_open();
-    } else if (match.method == "close") {
-      call.set_command_close();
-    } else if (match.method == "stop") {
-      call.set_command_stop();
-    } else if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto call = obj->make_call();
+  if (match.method == "open") {
+    call.set_command_open();
+  } else if (match.method == "close") {
+    call.set_command_close();
+  } else if (match.method == "stop") {
+    call.set_command_stop();
+  } else if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    auto traits = obj->get_traits();
-    if ((request->hasParam("position") && !traits.get_supports_position()) ||
-        (request->hasParam("tilt") && !traits.get_supports_tilt())) {
-      request->send(409);
-      return;
-    }
+  auto traits = obj->get_traits();
+  if ((request->hasParam("position") && !traits.get_supports_position()) ||
+      (request->hasParam("tilt") && !traits.get_supports_tilt())) {
+    request->send(409);
+    return;
+  }
 
-    if (request->hasParam("position")) {
-      auto position = parse_number<float>(request->getParam("position")->value().c_str());
-      if (position.has_value()) {
-        call.set_position(*position);
-      }
+  if (request->hasParam("position")) {
+    auto position = parse_number<float>(request->getParam("position")->value().c_str());
+    if (position.has_value()) {
+      call.set_position(*position);
     }
-    if (request->hasParam("tilt")) {
-      auto tilt = parse_number<float>(request->getParam("tilt")->value().c_str());
-      if (tilt.has_value()) {
-        call.set_tilt(*tilt);
-      }
+  }
+  if (request->hasParam("tilt")) {
+    auto tilt = parse_number<float>(request->getParam("tilt")->value().c_str());
+    if (tilt.has_value()) {
+      call.set_tilt(*tilt);
     }
-
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
+  return json::write_json([obj, start_config](json::JsonWriter &writer) {
+    set_json_state_value(writer, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
                          obj->position, start_config);
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
+    writer.add("current_operation", cover::cover_operation_to_str(obj->current_operation));
 
     if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
+      writer.add("tilt", obj->tilt);
   });
 }
 #endif
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->number_json(obj, state, DETAIL_STATE));
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("value")) {
-      auto value = parse_number<float>(request->getParam("value")->value().c_str());
-      if (value.has_value())
-        call.set_value(*value);
-    }
+  number::Number *obj = App.get_number_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  if (request->method() == HTTP_GET) {
+    std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
     return;
   }
-  request->send(404);
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
+
+  auto call = obj->make_call();
+  if (request->hasParam("value")) {
+    auto value = parse_number<float>(request->getParam("value")->value().c_str());
+    if (value.has_value())
+      call.set_value(*value);
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &writer) {
+    set_json_id(writer, obj, "number-" + obj->get_object_id(), start_config);
     if (start_config == DETAIL_ALL) {
-      root["min_value"] = obj->traits.get_min_value();
-      root["max_value"] = obj->traits.get_max_value();
-      root["step"] = obj->traits.get_step();
-      root["mode"] = (int) obj->traits.get_mode();
+      writer.add("min_value", obj->traits.get_min_value());
+      writer.add("max_value", obj->traits.get_max_value());
+      writer.add("step", obj->traits.get_step());
+      writer.add("mode", (int) obj->traits.get_mode());
     }
     if (std::isnan(value)) {
-      root["value"] = "\"NaN\"";
-      root["state"] = "NA";
+      writer.add("value", "\"NaN\"");
+      writer.add("state", "NA");
     } else {
-      root["value"] = value;
+      writer.add("value", value);
       std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
       if (!obj->traits.get_unit_of_measurement().empty())
         state += " " + obj->traits.get_unit_of_measurement();
-      root["state"] = state;
+      writer.add("state", state);
     }
   });
 }
@@ -841,101 +931,100 @@ std::string WebServer::number_json(number::Number *obj, float value, JsonDetail
 
 #ifdef USE_TEXT
 void WebServer::on_text_update(text::Text *obj, const std::string &state) {
-  this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->text_json(obj, state, DETAIL_STATE));
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_texts()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->text_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "text/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("value")) {
-      String value = request->getParam("value")->value();
-      call.set_value(value.c_str());
-    }
+  text::Text *obj = App.get_text_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
+  if (request->method() == HTTP_GET) {
+    std::string data = this->text_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "text/json", data.c_str());
     return;
   }
-  request->send(404);
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
+
+  auto call = obj->make_call();
+  if (request->hasParam("value")) {
+    String value = request->getParam("value")->value();
+    call.set_value(value.c_str());
+  }
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::text_json(text::Text *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "text-" + obj->get_object_id(), start_config);
+  return json::write_json([obj, &value, start_config](json::JsonWriter &writer) {
+    set_json_id(writer, obj, "text-" + obj->get_object_id(), start_config);
     if (start_config == DETAIL_ALL) {
-      root["mode"] = (int) obj->traits.get_mode();
+      writer.add("mode", (int) obj->traits.get_mode());
     }
-    root["min_length"] = obj->traits.get_min_length();
-    root["max_length"] = obj->traits.get_max_length();
-    root["pattern"] = obj->traits.get_pattern();
+    writer.add("min_length", obj->traits.get_min_length());
+    writer.add("max_length", obj->traits.get_max_length());
+    writer.add("pattern", obj->traits.get_pattern());
     if (obj->traits.get_mode() == text::TextMode::TEXT_MODE_PASSWORD) {
-      root["state"] = "********";
+      writer.add("state", "********");
     } else {
-      root["state"] = value;
+      writer.add("state", value);
     }
-    root["value"] = value;
+    writer.add("value", value);
   });
 }
 #endif
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->select_json(obj, state, DETAIL_STATE));
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->select_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  select::Select *obj = App.get_select_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    if (match.method != "set") {
-      request->send(404);
-      return;
+  if (request->method() == HTTP_GET) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
     }
+    std::string data = this->select_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("option")) {
-      auto option = request->getParam("option")->value();
-      call.set_option(option.c_str());  // NOLINT(clang-diagnostic-deprecated-declarations)
-    }
+  auto call = obj->make_call();
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("option")) {
+    auto option = request->getParam("option")->value();
+    call.set_option(option.c_str());  // NOLINT(clang-diagnostic-deprecated-declarations)
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
+  return json::write_json([obj, &value, start_config](json::JsonWriter &writer) {
+    set_json_state_value(writer, obj, "select-" + obj->get_object_id(), value, value, start_config);
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("option");
+      writer.begin_array("option");
       for (auto &option : obj->traits.get_options()) {
-        opt.add(option);
+        writer.add(option);
       }
+      writer.end_array();
     }
   });
 }
@@ -946,140 +1035,147 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
-  this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->climate_json(obj, DETAIL_STATE));
 }
 
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->climate_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  climate::Climate *obj = App.get_climate_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->climate_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("mode")) {
-      auto mode = request->getParam("mode")->value();
-      call.set_mode(mode.c_str());
-    }
+  auto call = obj->make_call();
 
-    if (request->hasParam("target_temperature_high")) {
-      auto target_temperature_high = parse_number<float>(request->getParam("target_temperature_high")->value().c_str());
-      if (target_temperature_high.has_value())
-        call.set_target_temperature_high(*target_temperature_high);
-    }
+  if (request->hasParam("mode")) {
+    auto mode = request->getParam("mode")->value();
+    call.set_mode(mode.c_str());
+  }
 
-    if (request->hasParam("target_temperature_low")) {
-      auto target_temperature_low = parse_number<float>(request->getParam("target_temperature_low")->value().c_str());
-      if (target_temperature_low.has_value())
-        call.set_target_temperature_low(*target_temperature_low);
-    }
+  if (request->hasParam("target_temperature_high")) {
+    auto target_temperature_high = parse_number<float>(request->getParam("target_temperature_high")->value().c_str());
+    if (target_temperature_high.has_value())
+      call.set_target_temperature_high(*target_temperature_high);
+  }
 
-    if (request->hasParam("target_temperature")) {
-      auto target_temperature = parse_number<float>(request->getParam("target_temperature")->value().c_str());
-      if (target_temperature.has_value())
-        call.set_target_temperature(*target_temperature);
-    }
+  if (request->hasParam("target_temperature_low")) {
+    auto target_temperature_low = parse_number<float>(request->getParam("target_temperature_low")->value().c_str());
+    if (target_temperature_low.has_value())
+      call.set_target_temperature_low(*target_temperature_low);
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("target_temperature")) {
+    auto target_temperature = parse_number<float>(request->getParam("target_temperature")->value().c_str());
+    if (target_temperature.has_value())
+      call.set_target_temperature(*target_temperature);
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
+  return json::write_json([obj, start_config](json::JsonWriter &writer) {
+    set_json_id(writer, obj, "climate-" + obj->get_object_id(), start_config);
     const auto traits = obj->get_traits();
     int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
     int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
     char buf[16];
 
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("modes");
+      writer.begin_array("modes");
       for (climate::ClimateMode m : traits.get_supported_modes())
-        opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+        writer.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+      writer.end_array();
       if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("fan_modes");
+        writer.begin_array("fan_modes");
         for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
-          opt.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+          writer.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+        writer.end_array();
       }
 
       if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("custom_fan_modes");
+        writer.begin_array("custom_fan_modes");
         for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-          opt.add(custom_fan_mode);
+          writer.add(custom_fan_mode);
+        writer.end_array();
       }
       if (traits.get_supports_swing_modes()) {
-        JsonArray opt = root.createNestedArray("swing_modes");
+        writer.begin_array("swing_modes");
         for (auto swing_mode : traits.get_supported_swing_modes())
-          opt.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+          writer.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+        writer.end_array();
       }
       if (traits.get_supports_presets() && obj->preset.has_value()) {
-        JsonArray opt = root.createNestedArray("presets");
+        writer.begin_array("presets");
         for (climate::ClimatePreset m : traits.get_supported_presets())
-          opt.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+          writer.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+        writer.end_array();
       }
       if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-        JsonArray opt = root.createNestedArray("custom_presets");
+        writer.begin_array("custom_presets");
         for (auto const &custom_preset : traits.get_supported_custom_presets())
-          opt.add(custom_preset);
+          writer.add(custom_preset);
+        writer.end_array();
       }
     }
 
     bool has_state = false;
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-    root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-    root["step"] = traits.get_visual_target_temperature_step();
+    writer.add("mode", PSTR_LOCAL(climate_mode_to_string(obj->mode)));
+    writer.add("max_temp", value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy));
+    writer.add("min_temp", value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy));
+    writer.add("step", traits.get_visual_target_temperature_step());
     if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-      root["state"] = root["action"];
+      const char *action = PSTR_LOCAL(climate_action_to_string(obj->action));
+      writer.add("action", action);
+      writer.add("state", action);
       has_state = true;
     }
     if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
+      writer.add("fan_mode", PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value())));
     }
     if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
+      writer.add("custom_fan_mode", obj->custom_fan_mode.value());
     }
     if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
+      writer.add("preset", PSTR_LOCAL(climate_preset_to_string(obj->preset.value())));
     }
     if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
+      writer.add("custom_preset", obj->custom_preset.value());
     }
     if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
+      writer.add("swing_mode", PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode)));
     }
     if (traits.get_supports_current_temperature()) {
       if (!std::isnan(obj->current_temperature)) {
-        root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
+        writer.add("current_temperature", value_accuracy_to_string(obj->current_temperature, current_accuracy));
       } else {
-        root["current_temperature"] = "NA";
+        writer.add("current_temperature", "NA");
       }
     }
     if (traits.get_supports_two_point_target_temperature()) {
-      root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-      root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
+      writer.add("target_temperature_low", value_accuracy_to_string(obj->target_temperature_low, target_accuracy));
+      writer.add("target_temperature_high", value_accuracy_to_string(obj->target_temperature_high, target_accuracy));
       if (!has_state) {
-        root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
-                                                 target_accuracy);
+        writer.add("state", value_accuracy_to_string(
+                                (obj->target_temperature_high + obj->target_temperature_low) / 2.0f, target_accuracy));
       }
     } else {
-      root["target_temperature"] = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+      const std::string target_temperature = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+      writer.add("target_temperature", target_temperature);
       if (!has_state)
-        root["state"] = root["target_temperature"];
+        writer.add("state", target_temperature);
     }
   });
 }
@@ -1087,63 +1183,63 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
-  this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->lock_json(obj, obj->state, DETAIL_STATE));
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
+  return json::write_json([obj, value, start_config](json::JsonWriter &writer) {
+    set_json_icon_state_value(writer, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
                               start_config);
   });
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "lock") {
-      this->schedule_([obj]() { obj->lock(); });
-      request->send(200);
-    } else if (match.method == "unlock") {
-      this->schedule_([obj]() { obj->unlock(); });
-      request->send(200);
-    } else if (match.method == "open") {
-      this->schedule_([obj]() { obj->open(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  lock::Lock *obj = App.get_lock_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  if (request->method() == HTTP_GET) {
+    std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "lock") {
+    this->schedule_([obj]() { obj->lock(); });
+    request->send(200);
+  } else if (match.method == "unlock") {
+    this->schedule_([obj]() { obj->unlock(); });
+    request->send(200);
+  } else if (match.method == "open") {
+    this->schedule_([obj]() { obj->open(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
-  this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
+  this->send_state_event_(obj, this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE));
 }
 std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
                                                 alarm_control_panel::AlarmControlPanelState value,
                                                 JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
+  return json::write_json([obj, value, start_config](json::JsonWriter &writer) {
     char buf[16];
-    set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
+    set_json_icon_state_value(writer, obj, "alarm-control-panel-" + obj->get_object_id(),
                               PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
   });
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  alarm_control_panel::AlarmControlPanel *obj = App.get_alarm_control_panel_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    if (request->method() == HTTP_GET) {
-      std::string data = this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
   }
   request->send(404);
 }
@@ -5,7 +5,9 @@
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
+#include "esphome/core/entity_base.h"
 
+#include <map>
 #include <vector>
 #ifdef USE_ESP32
 #include <deque>
@@ -102,6 +104,16 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    * @param expose_log.
    */
   void set_expose_log(bool expose_log) { this->expose_log_ = expose_log; }
+  /** Set whether state events only contain the members that changed since the previous event of the entity.
+   *
+   * The id and the state are always included. Clients get the complete state of every entity when they connect,
+   * followed by a "snapshot" event with the state version, and merge the following events into it. The id of every
+   * state event is the state version after it. Only supported with ESP-IDF, where a client that can't keep up is
+   * disconnected instead of losing single events.
+   *
+   * @param delta_events.
+   */
+  void set_delta_events(bool delta_events) { this->delta_events_ = delta_events; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -278,6 +290,10 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   void schedule_(std::function<void()> &&f);
+  /// Send the DETAIL_STATE JSON of an entity to all clients, reduced to the changed members with delta events.
+  void send_state_event_(EntityBase *obj, const std::string &data);
+  /// Mark the end of the complete state sent to new clients with delta events.
+  void send_snapshot_event_();
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
@@ -295,6 +311,11 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool include_internal_{false};
   bool allow_ota_{true};
   bool expose_log_{true};
+  bool delta_events_{false};
+  /// Number of state events sent with delta events.
+  uint32_t state_version_{0};
+  /// The top level members of the last state event of each entity, for delta events.
+  std::map<EntityBase *, std::vector<std::string>> state_members_;
 #ifdef USE_ESP32
   std::deque<std::function<void()>> to_schedule_;
   SemaphoreHandle_t to_schedule_lock_;
@@ -1,6 +1,7 @@
 #ifdef USE_ESP_IDF
 
 #include <cstdarg>
+#include <sys/socket.h>
 
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
@@ -294,16 +295,39 @@ AsyncEventSource::~AsyncEventSource() {
 
 void AsyncEventSource::handleRequest(AsyncWebServerRequest *request) {
   auto *rsp = new AsyncEventSourceResponse(request, this);  // NOLINT(cppcoreguidelines-owning-memory)
+  // The session isn't shared yet, so the first event is sent from the httpd task without the lock
   if (this->on_connect_) {
     this->on_connect_(rsp);
   }
+  LockGuard guard{this->lock_};
   this->sessions_.insert(rsp);
 }
 
 void AsyncEventSource::send(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
+  // Anything logged while the sessions are locked, also by ESP-IDF, comes back here through the log callback
+  if (this->lock_owner_ == xTaskGetCurrentTaskHandle())
+    return;
+  size_t disconnected = 0;
+  {
+    LockGuard guard{this->lock_};
+    this->lock_owner_ = xTaskGetCurrentTaskHandle();
+    for (auto *ses : this->sessions_) {
+      if (!ses->send(message, event, id, reconnect))
+        disconnected++;
+    }
+    this->lock_owner_ = nullptr;
+  }
+  if (disconnected != 0)
+    ESP_LOGW(TAG, "Disconnected %zu event clients that fell too far behind", disconnected);
+}
+
+void AsyncEventSource::loop() {
+  LockGuard guard{this->lock_};
+  this->lock_owner_ = xTaskGetCurrentTaskHandle();
   for (auto *ses : this->sessions_) {
-    ses->send(message, event, id, reconnect);
+    ses->flush_();
   }
+  this->lock_owner_ = nullptr;
 }
 
 AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *request, AsyncEventSource *server)
@@ -330,13 +354,17 @@ AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *
 
 void AsyncEventSourceResponse::destroy(void *ptr) {
   auto *rsp = static_cast<AsyncEventSourceResponse *>(ptr);
-  rsp->server_->sessions_.erase(rsp);
+  {
+    // Called from the httpd task, the main loop may be sending to the session
+    LockGuard guard{rsp->server_->lock_};
+    rsp->server_->sessions_.erase(rsp);
+  }
   delete rsp;  // NOLINT(cppcoreguidelines-owning-memory)
 }
 
-void AsyncEventSourceResponse::send(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
+bool AsyncEventSourceResponse::send(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
   if (this->fd_ == 0) {
-    return;
+    return true;
   }
 
   std::string ev;
@@ -366,20 +394,42 @@ void AsyncEventSourceResponse::send(const char *message, const char *event, uint
   }
 
   if (ev.empty()) {
-    return;
+    return true;
   }
 
   ev.append(CRLF_STR, CRLF_LEN);
 
-  // Sending chunked content prelude
+  // Queue the event as one chunk of the chunked response
+  const size_t backlog = this->tx_buffer_.size() - this->tx_offset_;
   auto cs = str_snprintf("%x" CRLF_STR, 4 * sizeof(ev.size()) + CRLF_LEN, ev.size());
-  httpd_socket_send(this->hd_, this->fd_, cs.c_str(), cs.size(), 0);
-
-  // Sendiing content chunk
-  httpd_socket_send(this->hd_, this->fd_, ev.c_str(), ev.size(), 0);
+  if (backlog + cs.size() + ev.size() + CRLF_LEN > this->server_->max_client_backlog_) {
+    httpd_sess_trigger_close(this->hd_, this->fd_);
+    this->fd_ = 0;
+    return false;
+  }
+  this->tx_buffer_.append(cs);
+  this->tx_buffer_.append(ev);
+  this->tx_buffer_.append(CRLF_STR, CRLF_LEN);
+  this->flush_();
+  return true;
+}
 
-  // Indicate end of chunk
-  httpd_socket_send(this->hd_, this->fd_, CRLF_STR, CRLF_LEN, 0);
+void AsyncEventSourceResponse::flush_() {
+  while (this->fd_ != 0 && this->tx_offset_ < this->tx_buffer_.size()) {
+    int sent = httpd_socket_send(this->hd_, this->fd_, this->tx_buffer_.data() + this->tx_offset_,
+                                 this->tx_buffer_.size() - this->tx_offset_, MSG_DONTWAIT);
+    if (sent == HTTPD_SOCK_ERR_TIMEOUT)
+      return;  // Socket buffer full, continue in the next loop()
+    if (sent < 0) {
+      ESP_LOGV(TAG, "Sending events to socket %d failed: %d", this->fd_, sent);
+      httpd_sess_trigger_close(this->hd_, this->fd_);
+      this->fd_ = 0;
+      break;
+    }
+    this->tx_offset_ += sent;
+  }
+  this->tx_buffer_.clear();
+  this->tx_offset_ = 0;
 }
 
 }  // namespace web_server_idf
@@ -2,7 +2,12 @@
 #ifdef USE_ESP_IDF
 
 #include <esp_http_server.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
+#include "esphome/core/helpers.h"
+
+#include <atomic>
 #include <string>
 #include <functional>
 #include <vector>
@@ -217,14 +222,23 @@ class AsyncEventSourceResponse {
   friend class AsyncEventSource;
 
  public:
-  void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+  /** Queue an event for this client and send as much of it as possible without blocking.
+   *
+   * @return false if the client was disconnected because it fell too far behind.
+   */
+  bool send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
 
  protected:
   AsyncEventSourceResponse(const AsyncWebServerRequest *request, AsyncEventSource *server);
   static void destroy(void *p);
+  /// Send queued data until the socket would block.
+  void flush_();
   AsyncEventSource *server_;
   httpd_handle_t hd_{};
   int fd_{};
+  /// Events the socket didn't take yet, sent from the main loop instead of blocking it.
+  std::string tx_buffer_;
+  size_t tx_offset_{0};
 };
 
 using AsyncEventSourceClient = AsyncEventSourceResponse;
@@ -248,8 +262,23 @@ class AsyncEventSource : public AsyncWebHandler {
 
   void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
 
+  /// Continue sending queued events to slow clients. Call from the main loop.
+  void loop();
+
+  /** Limit the data queued per client, a client that falls further behind is disconnected.
+   *
+   * Dropping single events would leave the client with a stale state. Browsers reconnect an event source by
+   * themselves, and get the complete state again on the new connection.
+   */
+  void set_max_client_backlog(size_t max_client_backlog) { this->max_client_backlog_ = max_client_backlog; }
+
  protected:
   std::string url_;
+  size_t max_client_backlog_{8192};
+  /// Sessions are added and removed by the httpd task, and events are sent from the main loop.
+  Mutex lock_;
+  /// The task holding lock_, to drop events logged while sending events instead of deadlocking.
+  std::atomic<TaskHandle_t> lock_owner_{nullptr};
   std::set<AsyncEventSourceResponse *> sessions_;
   connect_handler_t on_connect_{};
 };
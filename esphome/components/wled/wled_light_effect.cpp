@@ -179,15 +179,7 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
   auto count = size / 3;
   auto max_leds = it.size();
 
-  for (uint16_t led = 0; led < count; ++led, payload += 3) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
+  it.range(0, std::min<int32_t>(count, max_leds)).set_from_buffer(payload, 3);
 
   return true;
 }
@@ -201,16 +193,7 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
   auto count = size / 4;
   auto max_leds = it.size();
 
-  for (uint16_t led = 0; led < count; ++led, payload += 4) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-    uint8_t w = payload[3];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b, w));
-    }
-  }
+  it.range(0, std::min<int32_t>(count, max_leds)).set_from_buffer(payload, 4);
 
   return true;
 }
@@ -233,15 +216,8 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
   auto count = size / 3;
   auto max_leds = it.size();
 
-  for (; count > 0; count--, payload += 3, led++) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
+  if (led < max_leds)
+    it.range(led, std::min<int32_t>(led + count, max_leds)).set_from_buffer(payload, 3);
 
   return true;
 }
@@ -7,10 +7,20 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#if defined(USE_TICKLESS_IDLE) && defined(USE_HOST)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
 
+#ifdef USE_TICKLESS_IDLE
+/// Longest time the loop sleeps without a scheduler deadline or wakeup, well below the task watchdog timeout.
+static const uint32_t TICKLESS_MAX_IDLE = 1000;
+#endif
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -25,8 +35,69 @@ void Application::register_component_(Component *comp) {
   }
   this->components_.push_back(comp);
 }
+void Application::build_entity_indexes_() {
+#ifdef USE_BINARY_SENSOR
+  this->binary_sensors_index_.build(this->binary_sensors_);
+#endif
+#ifdef USE_SWITCH
+  this->switches_index_.build(this->switches_);
+#endif
+#ifdef USE_BUTTON
+  this->buttons_index_.build(this->buttons_);
+#endif
+#ifdef USE_SENSOR
+  this->sensors_index_.build(this->sensors_);
+#endif
+#ifdef USE_TEXT_SENSOR
+  this->text_sensors_index_.build(this->text_sensors_);
+#endif
+#ifdef USE_FAN
+  this->fans_index_.build(this->fans_);
+#endif
+#ifdef USE_COVER
+  this->covers_index_.build(this->covers_);
+#endif
+#ifdef USE_CLIMATE
+  this->climates_index_.build(this->climates_);
+#endif
+#ifdef USE_LIGHT
+  this->lights_index_.build(this->lights_);
+#endif
+#ifdef USE_NUMBER
+  this->numbers_index_.build(this->numbers_);
+#endif
+#ifdef USE_SELECT
+  this->selects_index_.build(this->selects_);
+#endif
+#ifdef USE_TEXT
+  this->texts_index_.build(this->texts_);
+#endif
+#ifdef USE_LOCK
+  this->locks_index_.build(this->locks_);
+#endif
+#ifdef USE_MEDIA_PLAYER
+  this->media_players_index_.build(this->media_players_);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  this->alarm_control_panels_index_.build(this->alarm_control_panels_);
+#endif
+}
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()...");
+#ifdef USE_TICKLESS_IDLE
+#ifdef USE_HOST
+  if (::pipe(this->wake_pipe_) == 0) {
+    ::fcntl(this->wake_pipe_[0], F_SETFL, O_NONBLOCK);
+    ::fcntl(this->wake_pipe_[1], F_SETFL, O_NONBLOCK);
+  } else {
+    ESP_LOGW(TAG, "Could not create wake pipe, wake_loop() is ineffective");
+  }
+#elif defined(USE_ESP32) || defined(USE_LIBRETINY)
+  this->loop_task_ = xTaskGetCurrentTaskHandle();
+#endif
+#endif
+  this->build_entity_indexes_();
+
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
@@ -65,6 +136,9 @@ void Application::setup() {
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
+#ifdef USE_RUNTIME_STATS
+  const uint32_t loop_start = micros();
+#endif
 
   this->scheduler.call();
   this->feed_wdt();
@@ -79,11 +153,27 @@ void Application::loop() {
   }
   this->app_state_ = new_app_state;
 
+#ifdef USE_RUNTIME_STATS
+  const uint32_t loop_duration = micros() - loop_start;
+  this->loop_runtime_stat_.record(loop_duration);
+  uint8_t bucket = 0;
+  while (bucket < LOOP_HISTOGRAM_BUCKETS - 1 && loop_duration >= (LOOP_HISTOGRAM_BASE_US << bucket))
+    bucket++;
+  this->loop_histogram_[bucket]++;
+#endif
+
   const uint32_t now = millis();
 
   if (HighFrequencyLoopRequester::is_high_frequency()) {
     yield();
   } else {
+#ifdef USE_TICKLESS_IDLE
+    // Sleep until the next scheduler deadline, unless woken up earlier. Without pending timeouts the loop still runs
+    // every TICKLESS_MAX_IDLE ms, or every loop interval when some socket can't be waited on, some component polls
+    // in loop() or the config is still being dumped.
+    const uint32_t max_idle = this->can_idle_() ? TICKLESS_MAX_IDLE : this->loop_interval_;
+    this->idle_(std::min(this->scheduler.next_schedule_in().value_or(max_idle), max_idle));
+#else
     uint32_t delay_time = this->loop_interval_;
     if (now - this->last_loop_ < this->loop_interval_)
       delay_time = this->loop_interval_ - (now - this->last_loop_);
@@ -94,6 +184,7 @@ void Application::loop() {
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
     delay(delay_time);
+#endif
   }
   this->last_loop_ = now;
 
@@ -145,6 +236,79 @@ void Application::run_safe_shutdown_hooks() {
   }
 }
 
+#ifdef USE_TICKLESS_IDLE
+void Application::wake_loop() {
+#ifdef USE_HOST
+  if (this->wake_pipe_[1] != -1) {
+    const uint8_t data = 0;
+    // A full pipe already guarantees a wakeup, so the result doesn't matter
+    ssize_t written = ::write(this->wake_pipe_[1], &data, 1);
+    (void) written;
+  }
+#elif defined(USE_ESP32) || defined(USE_LIBRETINY)
+  if (this->loop_task_ != nullptr)
+    xTaskNotifyGive(this->loop_task_);
+#else
+  this->wake_requested_ = true;
+#endif
+}
+
+bool Application::can_idle_() {
+  if (this->poll_sockets_ || this->dump_config_at_ < this->components_.size())
+    return false;
+  // Asked after all components ran, work queued by a later component is seen by an earlier one
+  for (Component *component : this->looping_components_) {
+    if (!component->is_failed() && !component->can_idle())
+      return false;
+  }
+  return true;
+}
+
+bool Application::register_socket_fd(int fd) {
+#ifdef USE_HOST
+  if (fd >= 0) {
+    this->socket_fds_.push_back(fd);
+    return true;
+  }
+#endif
+  this->poll_sockets_ = true;
+  return false;
+}
+
+void Application::unregister_socket_fd(int fd) {
+#ifdef USE_HOST
+  // Only remove one entry, the same fd number may already have been reused and registered again
+  auto it = std::find(this->socket_fds_.begin(), this->socket_fds_.end(), fd);
+  if (it != this->socket_fds_.end())
+    this->socket_fds_.erase(it);
+#endif
+}
+
+void Application::idle_(uint32_t timeout) {
+#ifdef USE_HOST
+  this->pollfds_.clear();
+  if (this->wake_pipe_[0] != -1)
+    this->pollfds_.push_back({this->wake_pipe_[0], POLLIN, 0});
+  for (int fd : this->socket_fds_)
+    this->pollfds_.push_back({fd, POLLIN, 0});
+
+  int ret = ::poll(this->pollfds_.data(), this->pollfds_.size(), timeout);
+  if (ret > 0 && this->wake_pipe_[0] != -1 && (this->pollfds_[0].revents & POLLIN)) {
+    uint8_t buf[16];
+    while (::read(this->wake_pipe_[0], buf, sizeof(buf)) > 0) {
+    }
+  }
+#elif defined(USE_ESP32) || defined(USE_LIBRETINY)
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout));
+#else
+  const uint32_t start = millis();
+  while (!this->wake_requested_ && millis() - start < timeout)
+    delay(1);
+  this->wake_requested_ = false;
+#endif
+}
+#endif  // USE_TICKLESS_IDLE
+
 void Application::calculate_looping_components_() {
   for (auto *obj : this->components_) {
     if (obj->has_overridden_loop())
@@ -9,6 +9,18 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_TICKLESS_IDLE
+#ifdef USE_HOST
+#include <poll.h>
+#elif defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(USE_LIBRETINY)
+#include <FreeRTOS.h>
+#include <task.h>
+#endif
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -187,6 +199,38 @@ class Application {
    */
   void set_loop_interval(uint32_t loop_interval) { this->loop_interval_ = loop_interval; }
 
+  const std::vector<Component *> &get_components() const { return this->components_; }
+
+#ifdef USE_RUNTIME_STATS
+  /// Number of buckets of the loop duration histogram.
+  static const uint8_t LOOP_HISTOGRAM_BUCKETS = 12;
+  /// Upper bound of the first histogram bucket in microseconds, every following bucket doubles it.
+  static const uint32_t LOOP_HISTOGRAM_BASE_US = 64;
+
+  /// Time spent in Application::loop() since boot, excluding the idle time between iterations.
+  const RuntimeStat &get_loop_runtime_stat() const { return this->loop_runtime_stat_; }
+  /// Loop iterations by duration, the last bucket counts everything longer than the previous ones.
+  const uint32_t *get_loop_histogram() const { return this->loop_histogram_; }
+#endif
+
+#ifdef USE_TICKLESS_IDLE
+  /** Wake the main loop up from its idle wait.
+   *
+   * With tickless idle, the loop sleeps until the next scheduler deadline. Components that receive work from other
+   * tasks (network stacks, BLE, ...) call this so that the work is handled right away. Can be called from any task,
+   * but not from an interrupt handler.
+   */
+  void wake_loop();
+
+  /** Also wake the main loop up whenever this socket becomes readable.
+   *
+   * Only possible on the host platform. Elsewhere this returns false, and the loop falls back to running at least
+   * every loop interval so that the socket is still serviced.
+   */
+  bool register_socket_fd(int fd);
+  void unregister_socket_fd(int fd);
+#endif
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
   void feed_wdt();
@@ -202,127 +246,85 @@ class Application {
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->binary_sensors_index_.find(this->binary_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->switches_index_.find(this->switches_, key, include_internal);
   }
 #endif
 #ifdef USE_BUTTON
   const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
   button::Button *get_button_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->buttons_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->buttons_index_.find(this->buttons_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->sensors_index_.find(this->sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->text_sensors_index_.find(this->text_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
   fan::Fan *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->fans_index_.find(this->fans_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->covers_index_.find(this->covers_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->lights_index_.find(this->lights_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->climates_index_.find(this->climates_, key, include_internal);
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->numbers_index_.find(this->numbers_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT
   const std::vector<text::Text *> &get_texts() { return this->texts_; }
   text::Text *get_text_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->texts_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->texts_index_.find(this->texts_, key, include_internal);
   }
 #endif
 #ifdef USE_SELECT
   const std::vector<select::Select *> &get_selects() { return this->selects_; }
   select::Select *get_select_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->selects_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->selects_index_.find(this->selects_, key, include_internal);
   }
 #endif
 #ifdef USE_LOCK
   const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
   lock::Lock *get_lock_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->locks_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->locks_index_.find(this->locks_, key, include_internal);
   }
 #endif
 #ifdef USE_MEDIA_PLAYER
   const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
   media_player::MediaPlayer *get_media_player_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->media_players_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->media_players_index_.find(this->media_players_, key, include_internal);
   }
 #endif
 
@@ -331,10 +333,7 @@ class Application {
     return this->alarm_control_panels_;
   }
   alarm_control_panel::AlarmControlPanel *get_alarm_control_panel_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->alarm_control_panels_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->alarm_control_panels_index_.find(this->alarm_control_panels_, key, include_internal);
   }
 #endif
 
@@ -347,55 +346,80 @@ class Application {
 
   void calculate_looping_components_();
 
+  /// Build the indexes for the *_by_key() lookups, once all entities are registered and named.
+  void build_entity_indexes_();
+
   void feed_wdt_arch_();
 
+#ifdef USE_TICKLESS_IDLE
+  /// Block for at most `timeout` ms, or until wake_loop() is called or a registered socket becomes readable.
+  void idle_(uint32_t timeout);
+  /// Whether the loop may idle longer than the loop interval, see Component::can_idle().
+  bool can_idle_();
+#endif
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityIndex<binary_sensor::BinarySensor> binary_sensors_index_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityIndex<switch_::Switch> switches_index_{};
 #endif
 #ifdef USE_BUTTON
   std::vector<button::Button *> buttons_{};
+  EntityIndex<button::Button> buttons_index_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityIndex<sensor::Sensor> sensors_index_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityIndex<text_sensor::TextSensor> text_sensors_index_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::Fan *> fans_{};
+  EntityIndex<fan::Fan> fans_index_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityIndex<cover::Cover> covers_index_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityIndex<climate::Climate> climates_index_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityIndex<light::LightState> lights_index_{};
 #endif
 #ifdef USE_NUMBER
   std::vector<number::Number *> numbers_{};
+  EntityIndex<number::Number> numbers_index_{};
 #endif
 #ifdef USE_SELECT
   std::vector<select::Select *> selects_{};
+  EntityIndex<select::Select> selects_index_{};
 #endif
 #ifdef USE_TEXT
   std::vector<text::Text *> texts_{};
+  EntityIndex<text::Text> texts_index_{};
 #endif
 #ifdef USE_LOCK
   std::vector<lock::Lock *> locks_{};
+  EntityIndex<lock::Lock> locks_index_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
   std::vector<media_player::MediaPlayer *> media_players_{};
+  EntityIndex<media_player::MediaPlayer> media_players_index_{};
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
   std::vector<alarm_control_panel::AlarmControlPanel *> alarm_control_panels_{};
+  EntityIndex<alarm_control_panel::AlarmControlPanel> alarm_control_panels_index_{};
 #endif
 
   std::string name_;
@@ -408,6 +432,25 @@ class Application {
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+
+#ifdef USE_RUNTIME_STATS
+  RuntimeStat loop_runtime_stat_;
+  uint32_t loop_histogram_[LOOP_HISTOGRAM_BUCKETS]{};
+#endif
+
+#ifdef USE_TICKLESS_IDLE
+  /// Set when a socket could not be registered, limits the idle time to the loop interval.
+  bool poll_sockets_{false};
+#ifdef USE_HOST
+  std::vector<int> socket_fds_{};
+  std::vector<struct pollfd> pollfds_{};
+  int wake_pipe_[2]{-1, -1};
+#elif defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t loop_task_{nullptr};
+#else
+  volatile bool wake_requested_{false};
+#endif
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
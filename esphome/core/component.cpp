@@ -81,22 +81,34 @@ uint32_t Component::get_component_state() const { return this->component_state_;
 void Component::call() {
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
   switch (state) {
-    case COMPONENT_STATE_CONSTRUCTION:
+    case COMPONENT_STATE_CONSTRUCTION: {
       // State Construction: Call setup and set state to setup
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_SETUP;
+#ifdef USE_RUNTIME_STATS
+      RuntimeStatGuard guard{this->runtime_stats_.setup};
+#endif
       this->call_setup();
       break;
-    case COMPONENT_STATE_SETUP:
+    }
+    case COMPONENT_STATE_SETUP: {
       // State setup: Call first loop and set state to loop
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_LOOP;
+#ifdef USE_RUNTIME_STATS
+      RuntimeStatGuard guard{this->runtime_stats_.loop};
+#endif
       this->call_loop();
       break;
-    case COMPONENT_STATE_LOOP:
+    }
+    case COMPONENT_STATE_LOOP: {
       // State loop: Call loop
+#ifdef USE_RUNTIME_STATS
+      RuntimeStatGuard guard{this->runtime_stats_.loop};
+#endif
       this->call_loop();
       break;
+    }
     case COMPONENT_STATE_FAILED:  // NOLINT(bugprone-branch-clone)
       // State failed: Do nothing
       break;
@@ -217,4 +229,9 @@ WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
   }
 }
 
+#ifdef USE_RUNTIME_STATS
+RuntimeStatGuard::RuntimeStatGuard(RuntimeStat &stat) : stat_(stat), started_(micros()) {}
+RuntimeStatGuard::~RuntimeStatGuard() { this->stat_.record(micros() - this->started_); }
+#endif
+
 }  // namespace esphome
@@ -4,6 +4,7 @@
 #include <functional>
 #include <cmath>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -64,6 +65,28 @@ extern const uint32_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+#ifdef USE_RUNTIME_STATS
+/// Number of calls, cumulative and maximum duration of an operation, in microseconds.
+struct RuntimeStat {
+  uint32_t count{0};
+  uint64_t total_us{0};
+  uint32_t max_us{0};
+
+  void record(uint32_t duration_us) {
+    this->count++;
+    this->total_us += duration_us;
+    if (duration_us > this->max_us)
+      this->max_us = duration_us;
+  }
+};
+
+/// Time a component spent in setup() and loop() since boot.
+struct ComponentRuntime {
+  RuntimeStat setup;
+  RuntimeStat loop;
+};
+#endif
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -123,6 +146,16 @@ class Component {
 
   virtual bool can_proceed();
 
+#ifdef USE_TICKLESS_IDLE
+  /** Whether the main loop may idle past the loop interval before calling loop() again.
+   *
+   * With tickless idle, loop() is then only called again once a timeout is due, App.wake_loop() is called or a
+   * registered socket becomes readable. Components that poll something in loop() keep the default, which limits the
+   * idle time to the loop interval.
+   */
+  virtual bool can_idle() { return false; }
+#endif
+
   bool status_has_warning();
 
   bool status_has_error();
@@ -152,6 +185,10 @@ class Component {
    */
   const char *get_component_source() const;
 
+#ifdef USE_RUNTIME_STATS
+  const ComponentRuntime &get_runtime_stats() const { return this->runtime_stats_; }
+#endif
+
  protected:
   friend class Application;
 
@@ -271,6 +308,9 @@ class Component {
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+#ifdef USE_RUNTIME_STATS
+  ComponentRuntime runtime_stats_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -328,4 +368,17 @@ class WarnIfComponentBlockingGuard {
   Component *component_;
 };
 
+#ifdef USE_RUNTIME_STATS
+/// Records how long it was alive into a RuntimeStat.
+class RuntimeStatGuard {
+ public:
+  RuntimeStatGuard(RuntimeStat &stat);
+  ~RuntimeStatGuard();
+
+ protected:
+  RuntimeStat &stat_;
+  uint32_t started_;
+};
+#endif
+
 }  // namespace esphome
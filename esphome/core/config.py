@@ -56,6 +56,12 @@ LoopTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_SCHEDULER = "scheduler"
+CONF_TICKLESS_IDLE = "tickless_idle"
+
+SCHEDULER_HEAP = "heap"
+SCHEDULER_TIMER_WHEEL = "timer_wheel"
+SCHEDULERS = [SCHEDULER_HEAP, SCHEDULER_TIMER_WHEEL]
 
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
@@ -155,6 +161,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+            cv.Optional(CONF_SCHEDULER, default=SCHEDULER_HEAP): cv.one_of(
+                *SCHEDULERS, lower=True
+            ),
+            cv.Optional(CONF_TICKLESS_IDLE, default=False): cv.boolean,
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -389,6 +399,12 @@ async def to_code(config):
     if config[CONF_INCLUDES]:
         CORE.add_job(add_includes, config[CONF_INCLUDES])
 
+    if config[CONF_SCHEDULER] == SCHEDULER_TIMER_WHEEL:
+        cg.add_define("USE_SCHEDULER_TIMER_WHEEL")
+
+    if config[CONF_TICKLESS_IDLE]:
+        cg.add_define("USE_TICKLESS_IDLE")
+
     if CONF_PROJECT in config:
         cg.add_define("ESPHOME_PROJECT_NAME", config[CONF_PROJECT][CONF_NAME])
         cg.add_define("ESPHOME_PROJECT_VERSION", config[CONF_PROJECT][CONF_VERSION])
@@ -15,6 +15,7 @@
 
 // Feature flags
 #define USE_API
+#define USE_API_BATCH
 #define USE_API_NOISE
 #define USE_API_PLAINTEXT
 #define USE_ALARM_CONTROL_PANEL
@@ -122,9 +123,13 @@
 
 #ifdef USE_HOST
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_HOST_HEAP_COUNTER
 #endif
 
 // Disabled feature flags
 // #define USE_BSEC  // Requires a library with proprietary license.
+// #define USE_SCHEDULER_TIMER_WHEEL  // Alternative scheduler backend, mutually exclusive with the default one.
+// #define USE_RUNTIME_STATS  // Adds timing overhead to every component and scheduler call.
+// #define USE_TICKLESS_IDLE  // Changes the idle behavior of the main loop.
 
 #define USE_DASHBOARD_IMPORT
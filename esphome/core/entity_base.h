@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <cstdint>
+#include <vector>
 #include "string_ref.h"
 
 namespace esphome {
@@ -63,6 +65,40 @@ class EntityBase {
   EntityCategory entity_category_{ENTITY_CATEGORY_NONE};
 };
 
+/** Entities of one domain sorted by their object id hash, so that looking an entity up by key is a binary search.
+ *
+ * Built once by Application::setup(), after all entities have been registered and named. Lookups never modify the
+ * index, so they are safe from other tasks (web server, ...). Should an entity be registered later, lookups fall back
+ * to a linear scan.
+ */
+template<typename T> class EntityIndex {
+ public:
+  void build(const std::vector<T *> &entities) {
+    this->sorted_ = entities;
+    // Stable, so that an entity with a duplicate hash is found in registration order like with a linear scan
+    std::stable_sort(this->sorted_.begin(), this->sorted_.end(),
+                     [](T *a, T *b) { return a->get_object_id_hash() < b->get_object_id_hash(); });
+  }
+
+  T *find(const std::vector<T *> &entities, uint32_t key, bool include_internal) const {
+    if (this->sorted_.size() != entities.size()) {
+      for (auto *obj : entities)
+        if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
+          return obj;
+      return nullptr;
+    }
+    auto it = std::lower_bound(this->sorted_.begin(), this->sorted_.end(), key,
+                               [](T *obj, uint32_t key) { return obj->get_object_id_hash() < key; });
+    for (; it != this->sorted_.end() && (*it)->get_object_id_hash() == key; it++)
+      if (include_internal || !(*it)->is_internal())
+        return *it;
+    return nullptr;
+  }
+
+ protected:
+  std::vector<T *> sorted_;
+};
+
 class EntityBase_DeviceClass {
  public:
   /// Get the device class, using the manual override if set.
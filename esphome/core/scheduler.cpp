@@ -9,6 +9,88 @@ namespace esphome {
 
 static const char *const TAG = "scheduler";
 
+struct RetryArgs {
+  std::function<RetryResult(uint8_t)> func;
+  uint8_t retry_countdown;
+  uint32_t current_interval;
+  Component *component;
+  std::string name;
+  float backoff_increase_factor;
+  Scheduler *scheduler;
+};
+
+static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
+  RetryResult const retry_result = args->func(--args->retry_countdown);
+  if (retry_result == RetryResult::DONE || args->retry_countdown <= 0)
+    return;
+  // second execution of `func` happens after `initial_wait_time`
+  args->scheduler->set_timeout(args->component, args->name, args->current_interval, [args]() { retry_handler(args); });
+  // backoff_increase_factor applied to third & later executions
+  args->current_interval *= args->backoff_increase_factor;
+}
+
+void HOT Scheduler::set_retry(Component *component, const std::string &name, uint32_t initial_wait_time,
+                              uint8_t max_attempts, std::function<RetryResult(uint8_t)> func,
+                              float backoff_increase_factor) {
+  if (!name.empty())
+    this->cancel_retry(component, name);
+
+  if (initial_wait_time == SCHEDULER_DONT_RUN)
+    return;
+
+  ESP_LOGVV(TAG, "set_retry(name='%s', initial_wait_time=%" PRIu32 ", max_attempts=%u, backoff_factor=%0.1f)",
+            name.c_str(), initial_wait_time, max_attempts, backoff_increase_factor);
+
+  if (backoff_increase_factor < 0.0001) {
+    ESP_LOGE(TAG,
+             "set_retry(name='%s'): backoff_factor cannot be close to zero nor negative (%0.1f). Using 1.0 instead",
+             name.c_str(), backoff_increase_factor);
+    backoff_increase_factor = 1;
+  }
+
+  auto args = std::make_shared<RetryArgs>();
+  args->func = std::move(func);
+  args->retry_countdown = max_attempts;
+  args->current_interval = initial_wait_time;
+  args->component = component;
+  args->name = "retry$" + name;
+  args->backoff_increase_factor = backoff_increase_factor;
+  args->scheduler = this;
+
+  // First execution of `func` immediately
+  this->set_timeout(component, args->name, 0, [args]() { retry_handler(args); });
+}
+bool HOT Scheduler::cancel_retry(Component *component, const std::string &name) {
+  return this->cancel_timeout(component, "retry$" + name);
+}
+
+#ifdef USE_RUNTIME_STATS
+Scheduler::CallbackRuntimeStat *Scheduler::get_runtime_stat_(Component *component, const std::string &name,
+                                                             uint32_t name_hash) {
+  const auto key = std::make_pair(component, name_hash);
+  auto it = this->runtime_stats_.find(key);
+  if (it == this->runtime_stats_.end()) {
+    // Names can be generated at runtime, don't let them grow the map without bound
+    if (this->runtime_stats_.size() >= MAX_RUNTIME_STATS)
+      return &this->runtime_stats_other_;
+    it = this->runtime_stats_.emplace(key, CallbackRuntimeStat{component, name, {}}).first;
+  }
+  return &it->second;
+}
+std::vector<Scheduler::CallbackRuntimeStat> Scheduler::get_runtime_stats() {
+  LockGuard guard{this->lock_};
+  std::vector<CallbackRuntimeStat> stats;
+  stats.reserve(this->runtime_stats_.size() + 1);
+  for (auto &it : this->runtime_stats_)
+    stats.push_back(it.second);
+  if (this->runtime_stats_other_.stat.count != 0)
+    stats.push_back(this->runtime_stats_other_);
+  return stats;
+}
+#endif
+
+#ifndef USE_SCHEDULER_TIMER_WHEEL
+
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 
 // Uncomment to debug scheduler
@@ -79,61 +161,6 @@ bool HOT Scheduler::cancel_interval(Component *component, const std::string &nam
   return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
 }
 
-struct RetryArgs {
-  std::function<RetryResult(uint8_t)> func;
-  uint8_t retry_countdown;
-  uint32_t current_interval;
-  Component *component;
-  std::string name;
-  float backoff_increase_factor;
-  Scheduler *scheduler;
-};
-
-static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
-  RetryResult const retry_result = args->func(--args->retry_countdown);
-  if (retry_result == RetryResult::DONE || args->retry_countdown <= 0)
-    return;
-  // second execution of `func` happens after `initial_wait_time`
-  args->scheduler->set_timeout(args->component, args->name, args->current_interval, [args]() { retry_handler(args); });
-  // backoff_increase_factor applied to third & later executions
-  args->current_interval *= args->backoff_increase_factor;
-}
-
-void HOT Scheduler::set_retry(Component *component, const std::string &name, uint32_t initial_wait_time,
-                              uint8_t max_attempts, std::function<RetryResult(uint8_t)> func,
-                              float backoff_increase_factor) {
-  if (!name.empty())
-    this->cancel_retry(component, name);
-
-  if (initial_wait_time == SCHEDULER_DONT_RUN)
-    return;
-
-  ESP_LOGVV(TAG, "set_retry(name='%s', initial_wait_time=%" PRIu32 ", max_attempts=%u, backoff_factor=%0.1f)",
-            name.c_str(), initial_wait_time, max_attempts, backoff_increase_factor);
-
-  if (backoff_increase_factor < 0.0001) {
-    ESP_LOGE(TAG,
-             "set_retry(name='%s'): backoff_factor cannot be close to zero nor negative (%0.1f). Using 1.0 instead",
-             name.c_str(), backoff_increase_factor);
-    backoff_increase_factor = 1;
-  }
-
-  auto args = std::make_shared<RetryArgs>();
-  args->func = std::move(func);
-  args->retry_countdown = max_attempts;
-  args->current_interval = initial_wait_time;
-  args->component = component;
-  args->name = "retry$" + name;
-  args->backoff_increase_factor = backoff_increase_factor;
-  args->scheduler = this;
-
-  // First execution of `func` immediately
-  this->set_timeout(component, args->name, 0, [args]() { retry_handler(args); });
-}
-bool HOT Scheduler::cancel_retry(Component *component, const std::string &name) {
-  return this->cancel_timeout(component, "retry$" + name);
-}
-
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
   if (this->empty_())
     return {};
@@ -231,6 +258,9 @@ void HOT Scheduler::call() {
       //  - timeouts/intervals get cancelled
       {
         WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_RUNTIME_STATS
+        RuntimeStatGuard stat_guard{item->runtime_stat->stat};
+#endif
         item->callback();
       }
     }
@@ -300,6 +330,10 @@ void HOT Scheduler::pop_raw_() {
 }
 void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
   LockGuard guard{this->lock_};
+#ifdef USE_RUNTIME_STATS
+  if (item->runtime_stat == nullptr)
+    item->runtime_stat = this->get_runtime_stat_(item->component, item->name, fnv1_hash(item->name));
+#endif
   this->to_add_.push_back(std::move(item));
 }
 bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
@@ -361,4 +395,6 @@ bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
   return a_next_exec > b_next_exec;
 }
 
+#endif  // USE_SCHEDULER_TIMER_WHEEL
+
 }  // namespace esphome
@@ -4,8 +4,14 @@
 #include <memory>
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+#ifdef USE_RUNTIME_STATS
+#include <map>
+#include <utility>
+#endif
+
 namespace esphome {
 
 class Component;
@@ -27,6 +33,104 @@ class Scheduler {
 
   void process_to_add();
 
+#ifdef USE_RUNTIME_STATS
+  /// Time spent in the callbacks of all timeouts/intervals of a component that share the same name.
+  struct CallbackRuntimeStat {
+    Component *component;
+    std::string name;
+    RuntimeStat stat;
+  };
+  /// Maximum number of distinct timeouts/intervals that get their own entry, the others share one.
+  static const size_t MAX_RUNTIME_STATS = 64;
+
+  /// Copy of the callback timings since boot, ordered by component.
+  std::vector<CallbackRuntimeStat> get_runtime_stats();
+
+ protected:
+  /// Find or create the stats entry of a timeout/interval, `lock_` must be held.
+  CallbackRuntimeStat *get_runtime_stat_(Component *component, const std::string &name, uint32_t name_hash);
+
+  /// Keyed on the component and the hash of the name, entries are added from any task that schedules an item.
+  std::map<std::pair<Component *, uint32_t>, CallbackRuntimeStat> runtime_stats_;
+  /// Shared by all timeouts/intervals once runtime_stats_ is full.
+  CallbackRuntimeStat runtime_stats_other_{nullptr, "<other>", {}};
+#endif
+
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+ protected:
+  /// Number of bits of the deadline covered by each wheel level.
+  static const uint8_t WHEEL_LEVEL_BITS = 4;
+  static const uint8_t WHEEL_LEVEL_SIZE = 1 << WHEEL_LEVEL_BITS;
+  static const uint8_t WHEEL_LEVEL_MASK = WHEEL_LEVEL_SIZE - 1;
+  /// 8 levels of 16 slots cover the full 32-bit millisecond range of a timeout/interval.
+  static const uint8_t WHEEL_LEVELS = 8;
+  /// Items are allocated from the heap in blocks of this size and never returned to it.
+  static const uint8_t POOL_BLOCK_SIZE = 16;
+
+  /** A pooled timer entry.
+   *
+   * Each item is linked into at most one wheel slot (or the pending list) through `next`/`pprev`, and into the
+   * cancellation index through `index_next`/`index_pprev`. `pprev` points at the `next` field of the previous item
+   * (or at the list head), so unlinking is O(1) without knowing which list the item is in.
+   */
+  struct SchedulerItem {
+    Component *component;
+    uint32_t name_hash;
+    enum Type : uint8_t { TIMEOUT, INTERVAL } type;
+    enum State : uint8_t { FREE, PENDING, SCHEDULED, RUNNING } state;
+    bool remove;
+    /// Index into `wheel_` while SCHEDULED.
+    uint8_t slot;
+    uint32_t interval;
+    uint64_t expires;
+    std::function<void()> callback;
+#ifdef USE_RUNTIME_STATS
+    CallbackRuntimeStat *runtime_stat;
+#endif
+
+    SchedulerItem *next;
+    SchedulerItem **pprev;
+    SchedulerItem *index_next;
+    SchedulerItem **index_pprev;
+
+    const char *get_type_str() { return this->type == INTERVAL ? "interval" : "timeout"; }
+  };
+
+  static void link_(SchedulerItem **head, SchedulerItem *item);
+
+  uint64_t millis_();
+  SchedulerItem *alloc_item_();
+  void free_item_(SchedulerItem *item);
+  void push_(Component *component, const std::string &name, uint32_t name_hash, SchedulerItem::Type type,
+             uint32_t interval, uint64_t expires, std::function<void()> &&func);
+  bool cancel_item_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  void wheel_insert_(SchedulerItem *item);
+  void wheel_unlink_(SchedulerItem *item);
+  bool wheel_empty_();
+  uint8_t cascade_(uint8_t level);
+  SchedulerItem **index_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  void index_insert_(SchedulerItem *item);
+  void index_unlink_(SchedulerItem *item);
+  void index_grow_();
+  optional<uint64_t> next_expiry_();
+
+  Mutex lock_;
+  /// Heads of the intrusive slot lists, `wheel_[level * WHEEL_LEVEL_SIZE + slot]`.
+  SchedulerItem *wheel_[WHEEL_LEVELS * WHEEL_LEVEL_SIZE]{};
+  /// One bit per non-empty slot, per level.
+  uint16_t occupied_[WHEEL_LEVELS]{};
+  /// Items added since the last call(), inserted into the wheel by process_to_add().
+  SchedulerItem *to_add_{nullptr};
+  /// All ticks before this one have been processed.
+  uint64_t wheel_time_{0};
+  /// Hash buckets keyed on (component, name, type); grows as more items are alive.
+  std::vector<SchedulerItem *> index_;
+  std::vector<std::unique_ptr<SchedulerItem[]>> pool_;
+  SchedulerItem *free_{nullptr};
+  size_t alive_{0};
+  uint32_t last_millis_{0};
+  uint32_t millis_major_{0};
+#else
  protected:
   struct SchedulerItem {
     Component *component;
@@ -40,6 +144,9 @@ class Scheduler {
     std::function<void()> callback;
     bool remove;
     uint8_t last_execution_major;
+#ifdef USE_RUNTIME_STATS
+    CallbackRuntimeStat *runtime_stat{nullptr};
+#endif
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
     inline uint8_t next_execution_major() {
@@ -79,6 +186,7 @@ class Scheduler {
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
+#endif  // USE_SCHEDULER_TIMER_WHEEL
 };
 
 }  // namespace esphome
@@ -0,0 +1,392 @@
+#include "scheduler.h"
+
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+
+#include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
+#include <cinttypes>
+
+namespace esphome {
+
+static const char *const TAG = "scheduler";
+
+// Hierarchical timer wheel backend, enabled with `esphome: scheduler: timer_wheel`.
+//
+// Deadlines are kept as 64-bit milliseconds. Level 0 has one slot per millisecond for the next 16 ms, level 1 one
+// slot per 16 ms for the next 256 ms and so on. When the level 0 index wraps around, the matching slot of the next
+// level is cascaded down into the lower levels. Items are taken from a grow-only pool and are found for cancellation
+// through a hash index on (component, fnv1_hash(name), type), so no operation allocates in steady state.
+//
+// The locking rules are the same as for the heap backend: `lock_` protects the wheel, the pending list, the pool and
+// the index. Callbacks run without the lock held; items added or re-armed while running go to the pending list and
+// are only inserted into the wheel by process_to_add(), so they run at the earliest on the next call().
+
+void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
+                                std::function<void()> func) {
+  const uint64_t now = this->millis_();
+  const uint32_t name_hash = fnv1_hash(name);
+
+  if (!name.empty())
+    this->cancel_item_(component, name_hash, SchedulerItem::TIMEOUT);
+
+  if (timeout == SCHEDULER_DONT_RUN)
+    return;
+
+  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
+
+  this->push_(component, name, name_hash, SchedulerItem::TIMEOUT, timeout, now + timeout, std::move(func));
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
+  return this->cancel_item_(component, fnv1_hash(name), SchedulerItem::TIMEOUT);
+}
+void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
+                                 std::function<void()> func) {
+  const uint64_t now = this->millis_();
+  const uint32_t name_hash = fnv1_hash(name);
+
+  if (!name.empty())
+    this->cancel_item_(component, name_hash, SchedulerItem::INTERVAL);
+
+  if (interval == SCHEDULER_DONT_RUN)
+    return;
+
+  // only put offset in lower half
+  uint32_t offset = 0;
+  if (interval != 0)
+    offset = (random_uint32() % interval) / 2;
+
+  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
+
+  // Like the heap backend, the first execution happens right away
+  this->push_(component, name, name_hash, SchedulerItem::INTERVAL, interval, now > offset ? now - offset : 0,
+              std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, fnv1_hash(name), SchedulerItem::INTERVAL);
+}
+
+optional<uint32_t> HOT Scheduler::next_schedule_in() {
+  const uint64_t now = this->millis_();
+  auto next = this->next_expiry_();
+  if (!next.has_value())
+    return {};
+  if (*next <= now)
+    return 0;
+  return std::min<uint64_t>(*next - now, UINT32_MAX);
+}
+void HOT Scheduler::call() {
+  const uint64_t now = this->millis_();
+  this->process_to_add();
+
+#ifdef ESPHOME_DEBUG_SCHEDULER
+  static uint64_t last_print = 0;
+
+  if (now - last_print > 2000) {
+    last_print = now;
+    LockGuard guard{this->lock_};
+    ESP_LOGVV(TAG, "Items: alive=%zu, pool=%zu, buckets=%zu, now=%" PRIu64, this->alive_,
+              this->pool_.size() * POOL_BLOCK_SIZE, this->index_.size(), now);
+    for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+      for (uint8_t slot = 0; slot < WHEEL_LEVEL_SIZE; slot++) {
+        for (auto *item = this->wheel_[level * WHEEL_LEVEL_SIZE + slot]; item != nullptr; item = item->next) {
+          ESP_LOGVV(TAG, "  %s 0x%08" PRIX32 " level=%u slot=%u interval=%" PRIu32 " expires=%" PRIu64,
+                    item->get_type_str(), item->name_hash, level, slot, item->interval, item->expires);
+        }
+      }
+    }
+  }
+#endif  // ESPHOME_DEBUG_SCHEDULER
+
+  this->lock_.lock();
+  while (this->wheel_time_ <= now) {
+    const uint8_t slot = this->wheel_time_ & WHEEL_LEVEL_MASK;
+    if (slot == 0) {
+      // Level 0 wrapped around, pull the next range of deadlines down from the higher levels. This is repeated when
+      // the same tick is visited again by a later call(), which is harmless as items are re-inserted in place.
+      for (uint8_t level = 1; level < WHEEL_LEVELS; level++) {
+        if (this->cascade_(level) != 0)
+          break;
+      }
+    }
+
+    SchedulerItem *item = this->wheel_[slot];
+    if (item == nullptr) {
+      // The current tick is never left behind, so that items added for `now` still run on the next call()
+      if (this->wheel_time_ == now)
+        break;
+      if (this->wheel_empty_()) {
+        this->wheel_time_ = now;
+        break;
+      }
+      // Nothing due at this tick, skip ahead to the next occupied slot but stop at the next wrap-around
+      uint8_t skip = 1;
+      while (slot + skip < WHEEL_LEVEL_SIZE && (this->occupied_[0] & (1 << (slot + skip))) == 0)
+        skip++;
+      this->wheel_time_ = std::min<uint64_t>(this->wheel_time_ + skip, now);
+      continue;
+    }
+
+    this->wheel_unlink_(item);
+    item->state = SchedulerItem::RUNNING;
+
+    // Don't run on failed components
+    if (item->component != nullptr && item->component->is_failed()) {
+      this->index_unlink_(item);
+      this->free_item_(item);
+      continue;
+    }
+    this->lock_.unlock();
+
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+    ESP_LOGVV(TAG, "Running %s 0x%08" PRIX32 " with interval=%" PRIu32 " expires=%" PRIu64 " (now=%" PRIu64 ")",
+              item->get_type_str(), item->name_hash, item->interval, item->expires, now);
+#endif
+
+    // The item is neither in the wheel nor in the pending list while its callback runs. It can still be cancelled
+    // through the index, in which case `remove` is set and it is released below.
+    {
+      WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_RUNTIME_STATS
+      RuntimeStatGuard stat_guard{item->runtime_stat->stat};
+#endif
+      item->callback();
+    }
+
+    this->lock_.lock();
+    if (item->remove) {
+      // Cancelled during the callback, already removed from the index
+      this->free_item_(item);
+    } else if (item->type == SchedulerItem::TIMEOUT) {
+      this->index_unlink_(item);
+      this->free_item_(item);
+    } else {
+      if (item->interval != 0 && now >= item->expires)
+        item->expires += ((now - item->expires) / item->interval + 1) * item->interval;
+      item->state = SchedulerItem::PENDING;
+      link_(&this->to_add_, item);
+    }
+  }
+  this->lock_.unlock();
+
+  this->process_to_add();
+}
+void HOT Scheduler::process_to_add() {
+  LockGuard guard{this->lock_};
+  if (this->to_add_ == nullptr)
+    return;
+
+  // An empty wheel can be moved to the current time, so that the next call() doesn't have to walk over the gap
+  if (this->wheel_empty_())
+    this->wheel_time_ = std::max(this->wheel_time_, this->millis_());
+
+  while (this->to_add_ != nullptr) {
+    SchedulerItem *item = this->to_add_;
+    this->wheel_unlink_(item);
+    this->wheel_insert_(item);
+  }
+}
+uint64_t Scheduler::millis_() {
+  const uint32_t now = millis();
+  if (now < this->last_millis_) {
+    ESP_LOGD(TAG, "Incrementing scheduler major");
+    this->millis_major_++;
+  }
+  this->last_millis_ = now;
+  return (uint64_t(this->millis_major_) << 32) | now;
+}
+
+Scheduler::SchedulerItem *Scheduler::alloc_item_() {
+  if (this->free_ == nullptr) {
+    std::unique_ptr<SchedulerItem[]> block(new SchedulerItem[POOL_BLOCK_SIZE]);
+    for (uint8_t i = 0; i < POOL_BLOCK_SIZE; i++) {
+      block[i].state = SchedulerItem::FREE;
+      block[i].next = this->free_;
+      this->free_ = &block[i];
+    }
+    this->pool_.push_back(std::move(block));
+  }
+  SchedulerItem *item = this->free_;
+  this->free_ = item->next;
+  this->alive_++;
+  return item;
+}
+void Scheduler::free_item_(SchedulerItem *item) {
+  // Release anything captured by the callback now rather than when the item is reused
+  item->callback = nullptr;
+  item->state = SchedulerItem::FREE;
+  item->next = this->free_;
+  this->free_ = item;
+  this->alive_--;
+}
+void HOT Scheduler::push_(Component *component, const std::string &name, uint32_t name_hash, SchedulerItem::Type type,
+                          uint32_t interval, uint64_t expires, std::function<void()> &&func) {
+  LockGuard guard{this->lock_};
+  SchedulerItem *item = this->alloc_item_();
+  item->component = component;
+  item->name_hash = name_hash;
+  item->type = type;
+  item->interval = interval;
+  item->expires = expires;
+  item->callback = std::move(func);
+#ifdef USE_RUNTIME_STATS
+  item->runtime_stat = this->get_runtime_stat_(component, name, name_hash);
+#endif
+  item->remove = false;
+  item->state = SchedulerItem::PENDING;
+  link_(&this->to_add_, item);
+
+  if (this->alive_ > this->index_.size() * 2)
+    this->index_grow_();
+  this->index_insert_(item);
+}
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t name_hash, SchedulerItem::Type type) {
+  // obtain lock because this function can be called from non-loop task context
+  LockGuard guard{this->lock_};
+  if (this->index_.empty())
+    return false;
+
+  bool ret = false;
+  SchedulerItem *item = *this->index_bucket_(component, name_hash, type);
+  while (item != nullptr) {
+    SchedulerItem *next = item->index_next;
+    if (item->component == component && item->name_hash == name_hash && item->type == type && !item->remove) {
+      this->index_unlink_(item);
+      if (item->state == SchedulerItem::RUNNING) {
+        // Freed by call() once the callback returns
+        item->remove = true;
+      } else {
+        this->wheel_unlink_(item);
+        this->free_item_(item);
+      }
+      ret = true;
+    }
+    item = next;
+  }
+  return ret;
+}
+
+void Scheduler::link_(SchedulerItem **head, SchedulerItem *item) {
+  item->next = *head;
+  if (item->next != nullptr)
+    item->next->pprev = &item->next;
+  item->pprev = head;
+  *head = item;
+}
+void HOT Scheduler::wheel_insert_(SchedulerItem *item) {
+  // Overdue items go into the slot that is processed next
+  uint64_t expires = std::max(item->expires, this->wheel_time_);
+  uint64_t delta = expires - this->wheel_time_;
+  if (delta > UINT32_MAX) {
+    // Only possible for timeouts set close to SCHEDULER_DONT_RUN; the item is cascaded with its real deadline later
+    delta = UINT32_MAX;
+    expires = this->wheel_time_ + delta;
+  }
+
+  uint8_t level = 0;
+  while (level < WHEEL_LEVELS - 1 && (delta >> (WHEEL_LEVEL_BITS * (level + 1))) != 0)
+    level++;
+  const uint8_t slot = (expires >> (WHEEL_LEVEL_BITS * level)) & WHEEL_LEVEL_MASK;
+
+  item->slot = level * WHEEL_LEVEL_SIZE + slot;
+  item->state = SchedulerItem::SCHEDULED;
+  link_(&this->wheel_[item->slot], item);
+  this->occupied_[level] |= 1 << slot;
+}
+void HOT Scheduler::wheel_unlink_(SchedulerItem *item) {
+  *item->pprev = item->next;
+  if (item->next != nullptr)
+    item->next->pprev = item->pprev;
+  if (item->state == SchedulerItem::SCHEDULED && this->wheel_[item->slot] == nullptr)
+    this->occupied_[item->slot / WHEEL_LEVEL_SIZE] &= ~(1 << (item->slot % WHEEL_LEVEL_SIZE));
+}
+bool Scheduler::wheel_empty_() {
+  for (uint16_t occupied : this->occupied_) {
+    if (occupied != 0)
+      return false;
+  }
+  return true;
+}
+uint8_t HOT Scheduler::cascade_(uint8_t level) {
+  const uint8_t slot = (this->wheel_time_ >> (WHEEL_LEVEL_BITS * level)) & WHEEL_LEVEL_MASK;
+  SchedulerItem *item = this->wheel_[level * WHEEL_LEVEL_SIZE + slot];
+  this->wheel_[level * WHEEL_LEVEL_SIZE + slot] = nullptr;
+  this->occupied_[level] &= ~(1 << slot);
+  while (item != nullptr) {
+    SchedulerItem *next = item->next;
+    this->wheel_insert_(item);
+    item = next;
+  }
+  return slot;
+}
+optional<uint64_t> Scheduler::next_expiry_() {
+  LockGuard guard{this->lock_};
+  optional<uint64_t> next{};
+  auto consider = [&next](uint64_t expires) {
+    if (!next.has_value() || expires < *next)
+      next = expires;
+  };
+
+  for (auto *item = this->to_add_; item != nullptr; item = item->next)
+    consider(item->expires);
+
+  // Level 0 slots map to single ticks, the first occupied one is the earliest deadline of that level
+  for (uint8_t i = 0; i < WHEEL_LEVEL_SIZE; i++) {
+    if (this->occupied_[0] & (1 << ((this->wheel_time_ + i) & WHEEL_LEVEL_MASK))) {
+      consider(this->wheel_time_ + i);
+      break;
+    }
+  }
+  // Higher level slots cover consecutive ranges starting after the current index, so only the first occupied slot
+  // of each level needs to be searched
+  for (uint8_t level = 1; level < WHEEL_LEVELS; level++) {
+    if (this->occupied_[level] == 0)
+      continue;
+    const uint8_t current = (this->wheel_time_ >> (WHEEL_LEVEL_BITS * level)) & WHEEL_LEVEL_MASK;
+    for (uint8_t i = 1; i <= WHEEL_LEVEL_SIZE; i++) {
+      const uint8_t slot = (current + i) & WHEEL_LEVEL_MASK;
+      if ((this->occupied_[level] & (1 << slot)) == 0)
+        continue;
+      for (auto *item = this->wheel_[level * WHEEL_LEVEL_SIZE + slot]; item != nullptr; item = item->next)
+        consider(std::max(item->expires, this->wheel_time_));
+      break;
+    }
+  }
+  return next;
+}
+Scheduler::SchedulerItem **Scheduler::index_bucket_(Component *component, uint32_t name_hash,
+                                                    SchedulerItem::Type type) {
+  uint32_t key = name_hash ^ (uint32_t(reinterpret_cast<uintptr_t>(component)) * 2654435761UL) ^ type;
+  return &this->index_[key & (this->index_.size() - 1)];
+}
+void Scheduler::index_insert_(SchedulerItem *item) {
+  SchedulerItem **head = this->index_bucket_(item->component, item->name_hash, item->type);
+  item->index_next = *head;
+  if (item->index_next != nullptr)
+    item->index_next->index_pprev = &item->index_next;
+  item->index_pprev = head;
+  *head = item;
+}
+void Scheduler::index_unlink_(SchedulerItem *item) {
+  *item->index_pprev = item->index_next;
+  if (item->index_next != nullptr)
+    item->index_next->index_pprev = item->index_pprev;
+}
+void Scheduler::index_grow_() {
+  std::vector<SchedulerItem *> old;
+  old.swap(this->index_);
+  // Bucket count must stay a power of two
+  this->index_.resize(old.empty() ? 16 : old.size() * 2, nullptr);
+  for (auto *item : old) {
+    while (item != nullptr) {
+      SchedulerItem *next = item->index_next;
+      this->index_insert_(item);
+      item = next;
+    }
+  }
+}
+
+}  // namespace esphome
+
+#endif  // USE_SCHEDULER_TIMER_WHEEL
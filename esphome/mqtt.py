@@ -1,6 +1,7 @@
 from datetime import datetime
 import hashlib
 import logging
+import os
 import ssl
 import sys
 import time
@@ -22,6 +23,7 @@ from esphome.const import (
     CONF_TOPIC_PREFIX,
     CONF_USERNAME,
 )
+from esphome import binary_log
 from esphome.core import CORE, EsphomeError
 from esphome.log import color, Fore
 from esphome.util import safe_print
@@ -204,6 +206,21 @@ def get_esphome_device_ip(
     return dev_ip
 
 
+def _firmware_elf_path(config):
+    """The ELF file of the firmware, to read the strings of binary log messages."""
+    if CONF_ESPHOME not in config:
+        return None
+    from esphome import platformio_api
+
+    idedata = platformio_api.get_idedata(config)
+    if idedata is None or not os.path.isfile(idedata.firmware_elf_path):
+        _LOGGER.warning(
+            "Firmware ELF file not found, compile the configuration to decode binary logs"
+        )
+        return None
+    return idedata.firmware_elf_path
+
+
 def show_logs(config, topic=None, username=None, password=None, client_id=None):
     if topic is not None:
         pass  # already have topic
@@ -220,9 +237,20 @@ def show_logs(config, topic=None, username=None, password=None, client_id=None):
         return 1
     _LOGGER.info("Starting log output from %s", topic)
 
+    decoder = None
+
     def on_message(client, userdata, msg):
+        nonlocal decoder
         time_ = datetime.now().time().strftime("[%H:%M:%S]")
-        payload = msg.payload.decode(errors="backslashreplace")
+        if binary_log.is_binary_log(msg.payload):
+            if decoder is None:
+                decoder = binary_log.BinaryLogDecoder(_firmware_elf_path(config))
+            try:
+                payload = decoder.format_line(msg.payload)
+            except ValueError as err:
+                payload = f"Invalid binary log message: {err}"
+        else:
+            payload = msg.payload.decode(errors="backslashreplace")
         message = time_ + payload
         safe_print(message)
 
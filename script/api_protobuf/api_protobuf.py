@@ -182,6 +182,27 @@ class TypeInfo:
 
     encode_func = None
 
+    @property
+    def field_id_size(self):
+        # Size of the varint tag (field number and wire type) in front of the value
+        tag = self.number << 3
+        size = 1
+        while tag > 0x7F:
+            tag >>= 7
+            size += 1
+        return size
+
+    @property
+    def calculate_size_content(self):
+        return self.get_size_calculation(f"this->{self.field_name}")
+
+    def get_size_calculation(self, name, force=False):
+        raise NotImplementedError
+
+    def _size_call(self, func, value, force):
+        force_str = "true" if force else "false"
+        return f"ProtoSize::{func}(total_size, {self.field_id_size}, {value}, {force_str});"
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -210,6 +231,9 @@ class DoubleType(TypeInfo):
     decode_64bit = "value.as_double()"
     encode_func = "encode_double"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_fixed_field<8>", f"{name} != 0.0", force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
         o += f"out.append(buffer);"
@@ -223,6 +247,9 @@ class FloatType(TypeInfo):
     decode_32bit = "value.as_float()"
     encode_func = "encode_float"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_fixed_field<4>", f"{name} != 0.0f", force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
         o += f"out.append(buffer);"
@@ -236,6 +263,9 @@ class Int64Type(TypeInfo):
     decode_varint = "value.as_int64()"
     encode_func = "encode_int64"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_int64_field", name, force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
         o += f"out.append(buffer);"
@@ -249,6 +279,9 @@ class UInt64Type(TypeInfo):
     decode_varint = "value.as_uint64()"
     encode_func = "encode_uint64"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_uint64_field", name, force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%llu", {name});\n'
         o += f"out.append(buffer);"
@@ -262,6 +295,9 @@ class Int32Type(TypeInfo):
     decode_varint = "value.as_int32()"
     encode_func = "encode_int32"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_int32_field", name, force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
         o += f"out.append(buffer);"
@@ -275,6 +311,9 @@ class Fixed64Type(TypeInfo):
     decode_64bit = "value.as_fixed64()"
     encode_func = "encode_fixed64"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_fixed_field<8>", f"{name} != 0", force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%llu", {name});\n'
         o += f"out.append(buffer);"
@@ -288,6 +327,9 @@ class Fixed32Type(TypeInfo):
     decode_32bit = "value.as_fixed32()"
     encode_func = "encode_fixed32"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_fixed_field<4>", f"{name} != 0", force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRIu32, {name});\n'
         o += f"out.append(buffer);"
@@ -301,6 +343,9 @@ class BoolType(TypeInfo):
     decode_varint = "value.as_bool()"
     encode_func = "encode_bool"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_bool_field", name, force)
+
     def dump(self, name):
         o = f"out.append(YESNO({name}));"
         return o
@@ -315,6 +360,9 @@ class StringType(TypeInfo):
     decode_length = "value.as_string()"
     encode_func = "encode_string"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_string_field", name, force)
+
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
         return o
@@ -344,6 +392,9 @@ class MessageType(TypeInfo):
     def decode_length(self):
         return f"value.as_message<{self.cpp_type}>()"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_message_object", name, force)
+
     def dump(self, name):
         o = f"{name}.dump_to(out);"
         return o
@@ -358,6 +409,9 @@ class BytesType(TypeInfo):
     decode_length = "value.as_string()"
     encode_func = "encode_string"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_string_field", name, force)
+
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
         return o
@@ -370,6 +424,9 @@ class UInt32Type(TypeInfo):
     decode_varint = "value.as_uint32()"
     encode_func = "encode_uint32"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_uint32_field", name, force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRIu32, {name});\n'
         o += f"out.append(buffer);"
@@ -392,6 +449,9 @@ class EnumType(TypeInfo):
     def encode_func(self):
         return f"encode_enum<{self.cpp_type}>"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_enum_field", f"static_cast<uint32_t>({name})", force)
+
     def dump(self, name):
         o = f"out.append(proto_enum_to_string<{self.cpp_type}>({name}));"
         return o
@@ -404,6 +464,9 @@ class SFixed32Type(TypeInfo):
     decode_32bit = "value.as_sfixed32()"
     encode_func = "encode_sfixed32"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_fixed_field<4>", f"{name} != 0", force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
         o += f"out.append(buffer);"
@@ -417,6 +480,9 @@ class SFixed64Type(TypeInfo):
     decode_64bit = "value.as_sfixed64()"
     encode_func = "encode_sfixed64"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_fixed_field<8>", f"{name} != 0", force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
         o += f"out.append(buffer);"
@@ -430,6 +496,9 @@ class SInt32Type(TypeInfo):
     decode_varint = "value.as_sint32()"
     encode_func = "encode_sint32"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_sint32_field", name, force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
         o += f"out.append(buffer);"
@@ -443,6 +512,9 @@ class SInt64Type(TypeInfo):
     decode_varint = "value.as_sint64()"
     encode_func = "encode_sint64"
 
+    def get_size_calculation(self, name, force=False):
+        return self._size_call("add_sint64_field", name, force)
+
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
         o += f"out.append(buffer);"
@@ -530,6 +602,13 @@ class RepeatedTypeInfo(TypeInfo):
         o += f"}}"
         return o
 
+    @property
+    def calculate_size_content(self):
+        o = f"for (const auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
+        o += f"  {self._ti.get_size_calculation('it', True)}\n"
+        o += f"}}"
+        return o
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -570,6 +649,7 @@ def build_message_type(desc):
     decode_32bit = []
     decode_64bit = []
     encode = []
+    calculate_size = []
     dump = []
 
     for field in desc.field:
@@ -580,6 +660,7 @@ def build_message_type(desc):
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        calculate_size.append(ti.calculate_size_content)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -646,6 +727,18 @@ def build_message_type(desc):
     prot = "void encode(ProtoWriteBuffer buffer) const override;"
     public_content.append(prot)
 
+    o = f"void {desc.name}::calculate_size(uint32_t &total_size) const {{"
+    if calculate_size:
+        if len(calculate_size) == 1 and len(calculate_size[0]) + len(o) + 3 < 120:
+            o += f" {calculate_size[0]} "
+        else:
+            o += "\n"
+            o += indent("\n".join(calculate_size)) + "\n"
+    o += "}\n"
+    cpp += o
+    prot = "void calculate_size(uint32_t &total_size) const override;"
+    public_content.append(prot)
+
     o = f"void {desc.name}::dump_to(std::string &out) const {{"
     if dump:
         if len(dump) == 1 and len(dump[0]) + len(o) + 3 < 120:
@@ -0,0 +1,183 @@
+import struct
+
+import pytest
+
+from esphome import binary_log
+from esphome.binary_log import (
+    BINARY_LOG_FLAG_INLINE_FORMAT,
+    BINARY_LOG_FLAG_INLINE_TAG,
+    BINARY_LOG_MAGIC,
+    BinaryLogDecoder,
+)
+
+
+def _varint(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        b = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def s(value: int) -> bytes:
+    """A signed argument, as the firmware encodes it."""
+    return _varint((value << 1) ^ (value >> 63))
+
+
+def u(value: int) -> bytes:
+    """An unsigned argument, as the firmware encodes it."""
+    return _varint(value)
+
+
+def f(value: float) -> bytes:
+    """A floating point argument, as the firmware encodes it."""
+    return struct.pack("<d", value)
+
+
+def string(value: str) -> bytes:
+    """A string argument, as the firmware encodes it."""
+    return value.encode() + b"\0"
+
+
+def record(format_: str, *args: bytes, level: int = 5, tag: str = "test") -> bytes:
+    flags = BINARY_LOG_FLAG_INLINE_TAG | BINARY_LOG_FLAG_INLINE_FORMAT
+    return (
+        bytes([BINARY_LOG_MAGIC, level | flags << 4])
+        + _varint(42)
+        + string(tag)
+        + string(format_)
+        + b"".join(args)
+    )
+
+
+def decode_message(payload: bytes) -> str:
+    return BinaryLogDecoder().decode(payload)[3]
+
+
+@pytest.mark.parametrize(
+    "format_, args, expected",
+    (
+        ("%*d|", (s(5), s(42)), "   42|"),
+        ("%-*d|", (s(5), s(42)), "42   |"),
+        # A negative width argument left-justifies like the - flag
+        ("%*d|", (s(-5), s(42)), "42   |"),
+        ("%.*f", (s(2), f(3.14159)), "3.14"),
+        ("%*.*f", (s(8), s(3), f(2.5)), "   2.500"),
+        # A negative precision argument is ignored
+        ("%.*f", (s(-1), f(1.5)), "1.500000"),
+        ("%.*s|", (s(3), string("abc")), "abc|"),
+        ("%*s|", (s(-4), string("ab")), "ab  |"),
+    ),
+)
+def test_decode__star_width_and_precision(format_, args, expected):
+    assert decode_message(record(format_, *args)) == expected
+
+
+@pytest.mark.parametrize(
+    "format_, args, expected",
+    (
+        ("%hhd", (s(-1),), "-1"),
+        ("%hhu", (u(255),), "255"),
+        ("%hhx", (u(0xFF),), "ff"),
+        ("%hd", (s(-32768),), "-32768"),
+        ("%hu", (u(65535),), "65535"),
+        ("%ld", (s(-2147483648),), "-2147483648"),
+        ("%lx", (u(0xDEADBEEF),), "deadbeef"),
+        ("%lld", (s(-(2**63)),), "-9223372036854775808"),
+        ("%llu", (u(2**64 - 1),), "18446744073709551615"),
+        ("%jd", (s(-7),), "-7"),
+        ("%zu", (u(123),), "123"),
+        ("%td", (s(-3),), "-3"),
+        ("%Lf", (f(0.5),), "0.500000"),
+        ("%lf", (f(0.25),), "0.250000"),
+    ),
+)
+def test_decode__length_modifiers(format_, args, expected):
+    assert decode_message(record(format_, *args)) == expected
+
+
+@pytest.mark.parametrize(
+    "format_, args, expected",
+    (
+        # The firmware only encodes as many characters as the precision allows
+        ("%.3s", (string("abc"),), "abc"),
+        ("%.0s|", (string(""),), "|"),
+        ("%5.2s|", (string("ab"),), "   ab|"),
+        ("%-6.2s|", (string("ab"),), "ab    |"),
+        ("%s", (string("x" * 255),), "x" * 255),
+        ("%s %s", (string("a"), string("b")), "a b"),
+    ),
+)
+def test_decode__string_precision(format_, args, expected):
+    assert decode_message(record(format_, *args)) == expected
+
+
+@pytest.mark.parametrize(
+    "format_, args, expected",
+    (
+        ("%d%%", (s(50),), "50%"),
+        ("%5.1f|%-4u|%x", (f(21.25), u(7), u(255)), " 21.2|7   |ff"),
+        ("%#o %#x", (u(8), u(255)), "010 0xff"),
+        ("%c%c", (u(ord("o")), u(ord("k"))), "ok"),
+        ("%+d %05d", (s(3), s(-42)), "+3 -0042"),
+    ),
+)
+def test_decode__conversions(format_, args, expected):
+    assert decode_message(record(format_, *args)) == expected
+
+
+def test_decode__header():
+    payload = record("%u", u(1), level=3, tag="sensor")
+
+    assert BinaryLogDecoder().decode(payload) == (3, "sensor", 42, "1")
+
+
+def test_decode__invalid_conversion_keeps_rest_of_format():
+    # The firmware stops encoding arguments at an invalid conversion
+    assert decode_message(record("%d %y %d", s(1))) == "1 %y %d"
+
+
+def test_decode__addresses_without_elf():
+    payload = bytes([BINARY_LOG_MAGIC, 5]) + _varint(42) + u(0x40) + u(0x1234) + s(21)
+
+    level, tag, line, message = BinaryLogDecoder().decode(payload)
+
+    assert (level, tag, line) == (5, "<0x40>", 42)
+    assert message == "<format 0x1234> 2a"
+
+
+@pytest.mark.parametrize(
+    "payload",
+    (
+        b"",
+        b"\x00\x25",
+        bytes([BINARY_LOG_MAGIC]),
+        # Truncated line varint
+        bytes([BINARY_LOG_MAGIC, 5, 0x80]),
+        # Tag without its null terminator
+        bytes([BINARY_LOG_MAGIC, 5 | BINARY_LOG_FLAG_INLINE_TAG << 4, 42]) + b"tag",
+        record("%d"),
+        record("%s", b"abc"),
+        record("%f", b"\x00\x00\x00"),
+        record("%*d", s(5)),
+    ),
+)
+def test_decode__invalid_records(payload):
+    with pytest.raises(ValueError):
+        BinaryLogDecoder().decode(payload)
+
+
+def test_format_line():
+    line = BinaryLogDecoder().format_line(record("Value %d", s(-5), level=2, tag="x"))
+
+    assert line == "\033[0;33m[W][x:042]: Value -5\033[0m"
+
+
+def test_is_binary_log():
+    assert binary_log.is_binary_log(record("x"))
+    assert not binary_log.is_binary_log(b"[D][x:001]: text")
+    assert not binary_log.is_binary_log(b"")
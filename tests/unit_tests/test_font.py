@@ -0,0 +1,86 @@
+import pytest
+
+from esphome import core
+from esphome.components.font import encode_runs
+
+
+class Mask:
+    """A glyph mask like Pillow returns it, from rows of "#" (set) and "." (clear)."""
+
+    def __init__(self, *rows: str):
+        self.rows = rows
+        self.size = (len(rows[0]) if rows else 0, len(rows))
+
+    def getpixel(self, position):
+        x, y = position
+        return 255 if self.rows[y][x] == "#" else 0
+
+
+def decode_runs(data, width, height):
+    """Draw the run-length encoded glyph back to rows, like Glyph::for_each_span_() does."""
+    rows = []
+    pos = 0
+    for _ in range(height):
+        row = ["."] * width
+        runs = data[pos]
+        pos += 1
+        x = 0
+        for _ in range(runs):
+            skip, length = data[pos], data[pos + 1]
+            pos += 2
+            x += skip
+            row[x : x + length] = "#" * length
+            x += length
+        rows.append("".join(row))
+    assert pos == len(data)
+    return rows
+
+
+@pytest.mark.parametrize(
+    "rows, expected",
+    (
+        (("....",), [0]),
+        (("####",), [1, 0, 4]),
+        (("##..#",), [2, 0, 2, 2, 1]),
+        (("..##",), [1, 2, 2]),
+        ((".#.#.",), [2, 1, 1, 1, 1]),
+        (("#..", ".#.", "..#"), [1, 0, 1, 1, 1, 1, 1, 2, 1]),
+    ),
+)
+def test_encode_runs(rows, expected):
+    mask = Mask(*rows)
+
+    assert encode_runs(mask, *mask.size) == expected
+
+
+def test_encode_runs__splits_long_runs():
+    mask = Mask("#" * 300)
+
+    assert encode_runs(mask, *mask.size) == [2, 0, 255, 0, 45]
+
+
+def test_encode_runs__splits_long_skips():
+    mask = Mask("." * 300 + "#")
+
+    assert encode_runs(mask, *mask.size) == [2, 255, 0, 45, 1]
+
+
+def test_encode_runs__too_many_runs():
+    mask = Mask("#." * 256)
+
+    with pytest.raises(core.EsphomeError, match="too many runs"):
+        encode_runs(mask, *mask.size)
+
+
+@pytest.mark.parametrize(
+    "rows",
+    (
+        (".##.", "#..#", "####", "#..#"),
+        ("." * 600 + "#" * 520 + ".#",),
+        ("#" * 255, "." * 254 + "#", "#" + "." * 254),
+    ),
+)
+def test_encode_runs__round_trip(rows):
+    mask = Mask(*rows)
+
+    assert decode_runs(encode_runs(mask, *mask.size), *mask.size) == list(rows)